@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _COMPACTTOPOLOGY_H
+#define _COMPACTTOPOLOGY_H
+
+#include "GoTools/utils/Point.h"
+#include "GoTools/geometry/ParamSurface.h"
+#include "GoTools/geometry/ParamCurve.h"
+#include <vector>
+
+namespace Go
+{
+  class ftSurface;
+  class ftEdge;
+  class Vertex;
+
+  /// \brief Index based half-edge representation of the topology of a
+  /// face set. Faces, boundary loops, half-edges and vertices are stored
+  /// in flat arrays and refer to each other by index. The geometry is
+  /// referenced by surface and curve ids.
+  ///
+  /// The store is built from the object representation (ftSurface, Loop,
+  /// ftEdge and Vertex), and the object representation may be recreated
+  /// from the store. When built from faces, the originating objects can
+  /// be fetched by index, such that the store serves as a compact view
+  /// for traversals.
+  ///
+  /// The store comes in addition to the object representation and does
+  /// not by itself reduce memory use. The memory held by the objects is
+  /// released when the views are released and the faces are dropped by
+  /// the application. The topology may later be recreated by createFaces.
+  ///
+  /// The half-edges of a loop are stored consecutively in the sequence
+  /// of the loop. A half-edge runs from its start vertex to its end
+  /// vertex, and the twin runs in the opposite direction.
+
+  class GO_API CompactTopology
+  {
+  public:
+    /// Constructor. Build the store from a set of faces. Vertices are
+    /// identified by the Vertex objects of the edges and half-edges by
+    /// the twin pointers
+    CompactTopology(const std::vector<shared_ptr<ftSurface> >& faces);
+
+    /// Destructor
+    ~CompactTopology();
+
+    /// Number of faces
+    int nmbFaces() const
+    {
+      return (int)surfaces_.size();
+    }
+
+    /// Number of boundary loops
+    int nmbLoops() const
+    {
+      return (int)loop_face_.size();
+    }
+
+    /// Number of half-edges
+    int nmbHalfEdges() const
+    {
+      return (int)he_loop_.size();
+    }
+
+    /// Number of vertices
+    int nmbVertices() const
+    {
+      return (dim_ > 0) ? (int)vx_pos_.size()/dim_ : 0;
+    }
+
+    /// Number of distinct geometry curves referenced by the half-edges
+    int nmbCurves() const
+    {
+      return (int)curves_.size();
+    }
+
+    /// Face topology
+    /// Index of first loop in face and number of loops. The loops of a
+    /// face are consecutive and the outer loop is the first one
+    int faceFirstLoop(int face) const
+    {
+      return face_loop_[face];
+    }
+    int faceNmbLoops(int face) const
+    {
+      return face_loop_[face+1] - face_loop_[face];
+    }
+
+    /// Loop topology
+    int loopFace(int loop) const
+    {
+      return loop_face_[loop];
+    }
+    int loopFirstHalfEdge(int loop) const
+    {
+      return loop_he_[loop];
+    }
+    int loopNmbHalfEdges(int loop) const
+    {
+      return loop_he_[loop+1] - loop_he_[loop];
+    }
+
+    /// Half-edge topology
+    int halfEdgeLoop(int he) const
+    {
+      return he_loop_[he];
+    }
+    int halfEdgeFace(int he) const
+    {
+      return loop_face_[he_loop_[he]];
+    }
+    /// Next half-edge in the loop
+    int next(int he) const
+    {
+      int loop = he_loop_[he];
+      return (he+1 < loop_he_[loop+1]) ? he+1 : loop_he_[loop];
+    }
+    /// Previous half-edge in the loop
+    int prev(int he) const
+    {
+      int loop = he_loop_[he];
+      return (he > loop_he_[loop]) ? he-1 : loop_he_[loop+1]-1;
+    }
+    /// Twin half-edge in an adjacent face, -1 at a boundary
+    int twin(int he) const
+    {
+      return he_twin_[he];
+    }
+    /// Start vertex
+    int startVertex(int he) const
+    {
+      return he_vx_[2*he];
+    }
+    /// End vertex
+    int endVertex(int he) const
+    {
+      return he_vx_[2*he+1];
+    }
+
+    /// Half-edge geometry. Index of geometry curve, parameter interval
+    /// on this curve and whether the half-edge runs opposite to the curve
+    int halfEdgeCurve(int he) const
+    {
+      return he_curve_[he];
+    }
+    double tMin(int he) const
+    {
+      return he_par_[2*he];
+    }
+    double tMax(int he) const
+    {
+      return he_par_[2*he+1];
+    }
+    bool isReversed(int he) const
+    {
+      return (he_reversed_[he] != 0);
+    }
+
+    /// Vertex position
+    Point vertexPosition(int vx) const
+    {
+      return Point(vx_pos_.begin() + dim_*vx, vx_pos_.begin() + dim_*(vx+1));
+    }
+
+    /// Number of half-edges starting or ending in a vertex
+    int vertexNmbHalfEdges(int vx) const
+    {
+      return vx_he_start_[vx+1] - vx_he_start_[vx];
+    }
+    /// Half-edge number idx starting or ending in a vertex
+    int vertexHalfEdge(int vx, int idx) const
+    {
+      return vx_he_[vx_he_start_[vx] + idx];
+    }
+
+    /// Geometry
+    shared_ptr<ParamSurface> surface(int face) const
+    {
+      return surfaces_[face];
+    }
+    shared_ptr<ParamCurve> curve(int idx) const
+    {
+      return curves_[idx];
+    }
+
+    /// Traversals
+    /// Half-edges without a twin
+    void boundaryHalfEdges(std::vector<int>& half_edges) const;
+
+    /// Faces sharing at least one edge with a given face
+    void adjacentFaces(int face, std::vector<int>& faces) const;
+
+    /// Faces meeting in a vertex
+    void vertexFaces(int vx, std::vector<int>& faces) const;
+
+    /// Pairs of distinct vertices closer than a given tolerance. The
+    /// vertices are sorted on the first coordinate and swept
+    void closeVertices(double tol,
+		       std::vector<std::pair<int,int> >& vx_pairs) const;
+
+    /// Views. The objects from which the store is built
+    ftSurface* face(int face) const
+    {
+      return faces_[face];
+    }
+    ftEdge* edge(int he) const
+    {
+      return edges_[he];
+    }
+    shared_ptr<Vertex> vertex(int vx) const
+    {
+      return vertices_[vx];
+    }
+
+    /// Index of a face, an edge or a vertex given the object, -1 if not
+    /// in the store
+    int faceIndex(const ftSurface* face) const;
+    int halfEdgeIndex(const ftEdge* edge) const;
+    int vertexIndex(const Vertex* vx) const;
+
+    /// Conversion. Create faces with boundary loops, edges, vertices and
+    /// twin information from the store. The geometric surfaces and curves
+    /// are shared with the store
+    /// \param space_epsilon Tolerance used in the boundary loops
+    std::vector<shared_ptr<ftSurface> >
+      createFaces(double space_epsilon) const;
+
+    /// Release the views. The store no longer refers to the objects from
+    /// which it was built, and face(), edge() and vertex() may not be
+    /// used. The index lookup returns -1
+    void releaseViews();
+
+    /// Approximate memory use of the store in bytes, excluding geometry
+    /// and views
+    size_t memorySize() const;
+
+  private:
+    // Faces. Loops of face i are face_loop_[i], ..., face_loop_[i+1]-1
+    std::vector<int> face_loop_;
+    std::vector<shared_ptr<ParamSurface> > surfaces_;
+
+    // Loops. Half-edges of loop i are loop_he_[i], ..., loop_he_[i+1]-1
+    std::vector<int> loop_face_;
+    std::vector<int> loop_he_;
+
+    // Half-edges
+    std::vector<int> he_loop_;
+    std::vector<int> he_twin_;
+    std::vector<int> he_vx_;        // Start and end vertex
+    std::vector<int> he_curve_;
+    std::vector<double> he_par_;    // Parameter interval on curve
+    std::vector<char> he_reversed_;
+    std::vector<shared_ptr<ParamCurve> > curves_;
+
+    // Vertices. Positions and the half-edges starting or ending in vertex
+    // i, vx_he_[vx_he_start_[i]], ..., vx_he_[vx_he_start_[i+1]-1]
+    int dim_;
+    std::vector<double> vx_pos_;
+    std::vector<int> vx_he_start_;
+    std::vector<int> vx_he_;
+
+    // Views, and the same objects sorted on address for lookup
+    std::vector<ftSurface*> faces_;
+    std::vector<ftEdge*> edges_;
+    std::vector<shared_ptr<Vertex> > vertices_;
+    std::vector<std::pair<const ftSurface*, int> > face_lookup_;
+    std::vector<std::pair<const ftEdge*, int> > edge_lookup_;
+    std::vector<std::pair<const Vertex*, int> > vx_lookup_;
+  };
+
+} // namespace Go
+
+#endif // _COMPACTTOPOLOGY_H
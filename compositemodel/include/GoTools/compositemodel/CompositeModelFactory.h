@@ -73,6 +73,13 @@ class GO_API CompositeModelFactory
   /// Destructor
   ~CompositeModelFactory();
 
+  /// Surface models read from file postpone the topology and the cell
+  /// division until needed. See SurfaceModel::ensureTopology()
+  void setLazyTopology(bool lazy)
+  {
+    lazy_ = lazy;
+  }
+
   /// Create an empty model
   SurfaceModel* createEmpty();
 
@@ -199,6 +206,7 @@ class GO_API CompositeModelFactory
   double neighbour_;  // Threshold for whether surfaces are adjacent
   double kink_;       // Kink between adjacent surfaces 
   double bend_;       // Intended G1 discontinuity between adjacent surfaces
+  bool lazy_;         // Postpone topology build in surface models read from file
 
   // Read geometry from file converter
   CompositeModel* getGeometry(IGESconverter& conv, bool use_filetol,
@@ -65,7 +65,8 @@ class CompositeModelFileHandler
 
 public:
     CompositeModelFileHandler()
-      : MAJOR_VERSION_(0), MINOR_VERSION_(1), indent_("  "), fix_geom_(false)
+      : MAJOR_VERSION_(0), MINOR_VERSION_(1), indent_("  "), fix_geom_(false),
+      lazy_(false)
         {}
 
     ~CompositeModelFileHandler();
@@ -107,6 +108,13 @@ public:
     {
       fix_geom_ = fix_geom;
     }
+
+    /// Shells read from file postpone the topology and the cell division
+    /// until needed. See SurfaceModel::ensureTopology(). Default is false
+    void setLazyTopology(bool lazy)
+    {
+      lazy_ = lazy;
+    }
     
 protected:
 
@@ -158,6 +166,9 @@ protected:
 
     // Whether or not fixes of the geometry is to be performed
     bool fix_geom_;
+
+    // Whether or not the topology build of shells is postponed
+    bool lazy_;
     
     // Creator for our supported GeomObject's.
     virtual shared_ptr<GeomObject> 
@@ -83,6 +83,19 @@ class RegularizeFaceSet
     split_mode_ = split_mode;
   }
 
+  /// Regularize faces that are not coupled to other faces concurrently.
+  /// The faces are divided in groups where no two faces share a vertex
+  /// or a vertex adjacent face, and each group is regularized in parallel
+  /// before the result is merged into the model in a deterministic order.
+  /// Faces with correspondances, degeneracy or prioritized vertices, and
+  /// models belonging to a body, are still regularized sequentially.
+  /// T-joints are resolved in the final pass. The face sequence differs
+  /// from the sequential mode, so the resulting division may differ.
+  void setParallel(bool parallel)
+  {
+    parallel_ = parallel;
+  }
+
   /// Set information
   void setFaceCorrespondance(int idx1, int idx2);
 
@@ -115,6 +128,7 @@ class RegularizeFaceSet
   int split_mode_;
   bool split_in_cand_;
   int level_;
+  bool parallel_;
   std::vector<std::vector<std::pair<std::pair<Point, int>,
     std::pair<Point,int> > > > cand_split_;
 
@@ -134,6 +148,14 @@ class RegularizeFaceSet
 
   void splitInTJoints();
 
+  // Regularize independent faces concurrently. The faces are marked as
+  // finished in done
+  void divideIndependent(std::vector<shared_ptr<ftSurface> >& faces,
+			 std::vector<int>& perm,
+			 std::vector<int>& allow_deg,
+			 std::vector<shared_ptr<ftSurface> >& reg_faces,
+			 std::vector<int>& done);
+
   std::vector<shared_ptr<ftSurface> > 
     divideInTjoint(shared_ptr<ftSurface>& face,
 		   std::vector<shared_ptr<Vertex> >& Tvx,
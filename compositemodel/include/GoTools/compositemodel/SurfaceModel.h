@@ -57,6 +57,8 @@
 #include "GoTools/compositemodel/ftLine.h"
 #include "GoTools/compositemodel/FaceUtilities.h"
 #include <vector>
+#include <atomic>
+#include <mutex>
 
 namespace Go
 {
@@ -68,6 +70,7 @@ namespace Go
  class IntResultsSfModel;
  class Loop;
  class Body;
+ class CompactTopology;
  struct SamplePointData;
 
 //===========================================================================
@@ -93,21 +96,25 @@ class GO_API SurfaceModel : public CompositeModel
   ///             is an intentional sharp edge between the surfaces.(angles in radians)
   /// \param faces A vector of faces.
   /// \param adjacency_set True if the application knows that twin information between edges is set.
+  /// \param lazy If true, the topology and the cell division are not built
+  ///             until they are needed by a query. See ensureTopology().
   SurfaceModel(double approxtol,
 	       double gap,   // Gap between adjacent surfaces
 	       double neighbour,  // Threshold for whether surfaces are adjacent
 	       double kink,  // Kink between adjacent surfaces 
 	       double bend, // Intended G1 discontinuity between adjacent surfaces
 	       std::vector<shared_ptr<ftSurface> >& faces, // Input faces
-	       bool adjacency_set = false);   // If the application knows that twin
+	       bool adjacency_set = false,   // If the application knows that twin
                                               // information between edges is set, a more 
                                               // simple topology analysis may be performed
+	       bool lazy = false);
 
   /// Constructor taking a vector of faces.
   /// \param faces A vector of faces.
   /// \param space_epsilon 
   /// \param kink 
   /// \param adjacency_set
+  /// \param lazy Postpone the topology and the cell division until needed
   // @@@jbt - In many STEP-files only one tolerance is given. A
   // contructor which reflects this would be useful.
   // @@@vsk - The surface model checks itself for gaps and kinks. Thus, some kink tolerance
@@ -115,7 +122,7 @@ class GO_API SurfaceModel : public CompositeModel
   // files
   SurfaceModel(std::vector<shared_ptr<ftSurface> >& faces,
 	       double space_epsilon, double kink = 0.01,
-	       bool adjacency_set = false);
+	       bool adjacency_set = false, bool lazy = false);
 
   /// Constructor taking a vector of parametric surfaces
   /// \param approxtol Approximation error tolerance. Not used.
@@ -128,12 +135,14 @@ class GO_API SurfaceModel : public CompositeModel
   ///             surface normals form an angle which is larger than 'bend', there 
   ///             is an intentional sharp edge between the surfaces.(angles in radians)
   /// \param surfaces A vector of surfaces.
+  /// \param lazy Postpone the topology and the cell division until needed
   SurfaceModel(double approxtol,
 	       double gap,   // Gap between adjacent surfaces
 	       double neighbour,  // Threshold for whether surfaces are adjacent
 	       double kink,  // Kink between adjacent surfaces 
 	       double bend, // Intended G1 discontinuity between adjacent surfaces
-	       std::vector<shared_ptr<ParamSurface> >& surfaces); // Input surfaces
+	       std::vector<shared_ptr<ParamSurface> >& surfaces, // Input surfaces
+	       bool lazy = false);
 
  protected:
   SurfaceModel(double approxtol,
@@ -238,9 +247,60 @@ class GO_API SurfaceModel : public CompositeModel
   /// significance
   void swapFaces(int idx1, int idx2);
 
-  /// Creates the CellDivision object
+  /// Creates the CellDivision object. If the cell division is postponed,
+  /// only the face ids are updated
   void initializeCelldiv();
 
+  /// Build the topology if it has been postponed.
+  /// A model created with the lazy flag set only stores the faces.
+  /// Adjacency, boundary loops, vertex identity and twin face information
+  /// are built at the first call to a function that needs them, the cell
+  /// division at the first call to a function using it. Evaluation,
+  /// tesselation and access to faces and surfaces do not trigger any of
+  /// these. The postponed builds may be triggered from several threads.
+  /// Call this function before traversing the edges of faces fetched
+  /// from a lazy model.
+  void ensureTopology() const;
+
+  /// Build the cell division if it has been postponed
+  void ensureCelldiv() const;
+
+  /// Check if the topology is postponed and not yet built
+  bool topologyPending() const
+  {
+    return !topology_ready_;
+  }
+
+  /// Wall clock time (seconds) spent in the stages of the most recent
+  /// construction of the topology
+  struct BuildTimes
+  {
+    double celldiv;      ///< Cell division of the faces
+    double edges_boxes;  ///< Initial edges, face boxes and edge boxes
+    double face_pairs;   ///< Candidate pairs of adjacent faces
+    double stitching;    ///< Splitting of edges and setting of twin pointers
+    double boundaries;   ///< Boundary loops of the model
+    double twin_info;    ///< Vertex identity and twin face information
+
+    BuildTimes()
+      : celldiv(0.0), edges_boxes(0.0), face_pairs(0.0), stitching(0.0),
+	boundaries(0.0), twin_info(0.0)
+    {}
+
+    /// Total time of all stages
+    double total() const
+    {
+      return celldiv + edges_boxes + face_pairs + stitching + boundaries +
+	twin_info;
+    }
+  };
+
+  /// Stage times of the most recent topology construction
+  const BuildTimes& buildTimes() const
+  {
+    return build_times_;
+  }
+
   /// Return a cell in the cell division
   /// \param i Index of cell
   /// \return The cell
@@ -696,6 +756,7 @@ class GO_API SurfaceModel : public CompositeModel
       of the face orientation */
   void getInconsistentFacePairs(std::vector<std::pair<ftFaceBase*, ftFaceBase*> >& faces)
   {
+    ensureTopology();
     faces = inconsistent_orientation_;
   }
 
@@ -717,6 +778,24 @@ class GO_API SurfaceModel : public CompositeModel
   void getOverlappingFaces(double tol,
 			   std::vector<std::pair<ftSurface*, ftSurface*> >& faces);
 
+  /// Return indices of pairs of faces with overlapping bounding boxes.
+  /// The face boxes are sorted and swept in one coordinate direction,
+  /// thus only faces overlapping in this direction are compared.
+  /// \param tol Overlap tolerance
+  /// \retval face_pairs Indices of overlapping faces, first index less
+  /// than second, sorted by the first and then the second index
+  void getOverlappingFaces(double tol,
+			   std::vector<std::pair<int, int> >& face_pairs) const;
+
+  /// Return indices of pairs of faces with overlapping bounding boxes,
+  /// one face from this model and one from another model.
+  /// \param other The other model
+  /// \param tol Overlap tolerance
+  /// \retval face_pairs Indices of overlapping faces in this model
+  /// and in other, sorted by the first and then the second index
+  void getOverlappingFaces(const SurfaceModel& other, double tol,
+			   std::vector<std::pair<int, int> >& face_pairs) const;
+
   /// Return all vertices associated with this surface model
   /// \retval vertices Vector of pointers to all vertices.
   void getAllVertices(std::vector<shared_ptr<Vertex> >& vertices) const;
@@ -741,6 +820,12 @@ class GO_API SurfaceModel : public CompositeModel
       \retval Vector of pointers unique inner edges*/
   std::vector<shared_ptr<ftEdge> > getUniqueInnerEdges() const;
 
+  /// Create an index based half-edge representation of the topology of
+  /// this model. The store refers to the faces, edges and vertices of
+  /// the model, and must be recreated if the model is modified
+  /// \return Compact topology store
+  shared_ptr<CompactTopology> compactTopology() const;
+
   /// Return body (if any)
   Body* getBody();
 
@@ -863,6 +948,19 @@ class GO_API SurfaceModel : public CompositeModel
 
   std::vector<std::pair<ftFaceBase*, ftFaceBase*> > inconsistent_orientation_;
 
+  BuildTimes build_times_;
+
+  // Lazy construction. The ready flags are false while the topology or
+  // the cell division is postponed. The postponed builds of one model are
+  // serialized by the model's own lock
+  bool lazy_adjacency_set_;  // Postponed topology is given by twin information
+  mutable std::atomic<bool> topology_ready_;
+  mutable bool topology_building_;   // Guarded by lazy_mutex_
+  mutable std::atomic<bool> celldiv_ready_;
+  mutable std::recursive_mutex lazy_mutex_;
+
+  void makeCelldiv();
+
   void addSegment(ftCurve& cv, ftEdgeBase* edge, ftCurveType ty);
 
  private:
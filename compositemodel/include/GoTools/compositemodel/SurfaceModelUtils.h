@@ -112,6 +112,50 @@ namespace Go
 			     std::vector<bool>& at_bd2,
 			     Body *model2, double eps, double angtol,
 			     std::vector<std::vector<shared_ptr<ParamSurface> > >& groups);
+
+    /// Find all pairs of overlapping boxes within a set of boxes.
+    /// The boxes are sorted along the coordinate direction with the
+    /// largest spread and swept in this direction. Thus, only boxes
+    /// overlapping in this direction are compared.
+    /// \param boxes the boxes
+    /// \param tol overlap tolerance, see BoundingBox::overlaps()
+    /// \retval pairs indices of overlapping boxes, first index less
+    /// than second index, sorted by the first and then the second index
+    void overlappingBoxes(const std::vector<BoundingBox>& boxes,
+			  double tol, std::vector<std::pair<int, int> >& pairs);
+
+    /// Find all pairs of overlapping boxes, one from each of two sets
+    /// of boxes. The sets are swept together, see above.
+    /// \param boxes1 the first set of boxes
+    /// \param boxes2 the second set of boxes
+    /// \param tol overlap tolerance, see BoundingBox::overlaps()
+    /// \retval pairs indices of overlapping boxes in boxes1 and boxes2,
+    /// sorted by the first and then the second index
+    void overlappingBoxes(const std::vector<BoundingBox>& boxes1,
+			  const std::vector<BoundingBox>& boxes2,
+			  double tol, std::vector<std::pair<int, int> >& pairs);
+
+    /// Distribute pairs of objects into batches where each object
+    /// occurs at most once in a batch. The pairs of one batch may be
+    /// processed in parallel without sharing objects. The pairs
+    /// involving one particular object are placed in consecutive
+    /// batches in the order they are given.
+    /// \param pairs indices of the objects in each pair
+    /// \param same_set true if both indices of a pair refer to the same
+    /// set of objects, false if they refer to two different sets
+    /// \retval batches indices into pairs for each batch
+    void pairBatches(const std::vector<std::pair<int, int> >& pairs,
+		     bool same_set, std::vector<std::vector<int> >& batches);
+
+    /// Identify surfaces sharing geometry, which must not be evaluated
+    /// from different threads at the same time. Bounded surfaces are
+    /// identified by their underlying surface. All surfaces evaluated
+    /// through a volume get the same identity as volumes may be shared.
+    /// \param sfs the surfaces
+    /// \retval geom_id for each surface the index of its geometry
+    /// \return the number of distinct geometries
+    int geometryIdentity(const std::vector<shared_ptr<ParamSurface> >& sfs,
+			 std::vector<int>& geom_id);
   }
 }
 #endif
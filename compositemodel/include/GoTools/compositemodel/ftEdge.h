@@ -103,6 +103,13 @@ public:
            bool is_reversed = false,
 	   int entry_id = -1);
 
+    /// Constructor. Input is the curve representing the geometry of
+    /// the edge, the vertices and the curve parameters of the vertices.
+    /// The vertices are not projected onto the curve.
+    ftEdge(ftFaceBase* face, shared_ptr<ParamCurve> cv, double t1,
+	   shared_ptr<Vertex> v1, double t2, shared_ptr<Vertex> v2, 
+           bool is_reversed = false, int entry_id = -1);
+
     /// Destructor
     ~ftEdge();
 
@@ -430,10 +437,6 @@ private:
     /// meeting in an edge
     shared_ptr<EdgeVertex> all_edges_;
 
-    ftEdge(ftFaceBase* face, shared_ptr<ParamCurve> cv, double t1,
-	   shared_ptr<Vertex> v1, double t2, shared_ptr<Vertex> v2, 
-           bool is_reversed = false, int entry_id = -1);
-
     /// Split function with no shared_ptr. The returned edge is the reponsibility of the caller.
     /// Does not split the twin edge.
     ftEdge* splitAtVertexNoSharedPtr(shared_ptr<Vertex> vx);
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BEZIEREXTRACTION_H
+#define _BEZIEREXTRACTION_H
+
+#include <vector>
+#include "GoTools/geometry/BsplineBasis.h"
+#include "GoTools/utils/BoundingBox.h"
+#include "GoTools/utils/config.h"
+
+namespace Go
+{
+
+class SplineCurve;
+class SplineSurface;
+
+  /** Bezier extraction operators for a B-spline basis.
+   *
+   * Each non-empty knot interval of the basis is an element. On every
+   * element the non-zero B-splines are linear combinations of the Bernstein
+   * polynomials of the same degree over the element. The matrices giving
+   * this relation are computed once, and elements with the same operator
+   * (for instance all interior elements of a uniform knot vector) share
+   * storage. The operators of several bases are combined in a tensor
+   * product fashion by calling apply() once per parameter direction.
+   */
+
+class GO_API BezierExtraction
+{
+public:
+    /// Constructs an empty extraction
+    BezierExtraction();
+
+    /// Compute the extraction operators of a B-spline basis
+    explicit BezierExtraction(const BsplineBasis& basis);
+
+    /// Compute the extraction operators of a B-spline basis, replacing
+    /// current content
+    void setBasis(const BsplineBasis& basis);
+
+    /// The order of the basis
+    int order() const
+    { return order_; }
+
+    /// Number of elements, i.e. non-empty knot intervals
+    int numElements() const
+    { return (int)left_.size(); }
+
+    /// Start parameter of an element
+    double elementStart(int el) const
+    { return knots_[el]; }
+
+    /// End parameter of an element
+    double elementEnd(int el) const
+    { return knots_[el+1]; }
+
+    /// The index of the last knot at the start of the element, in the knot
+    /// vector of the basis
+    int elementLeft(int el) const
+    { return left_[el]; }
+
+    /// The index of the first B-spline which is non-zero in the element
+    int firstCoef(int el) const
+    { return left_[el] - order_ + 1; }
+
+    /// The element containing a given parameter value. Parameters at an
+    /// internal knot belong to the element starting at this knot, except
+    /// at the end of the parameter domain.
+    int elementIndex(double par) const;
+
+    /// Number of distinct extraction operators
+    int numOperators() const
+    { return (order_ > 0) ? (int)operators_.size()/(order_*order_) : 0; }
+
+    /// Index of the extraction operator of an element among the distinct
+    /// operators
+    int operatorIndex(int el) const
+    { return op_index_[el]; }
+
+    /// The extraction operator of an element. The operator is an
+    /// order*order matrix stored row by row. Row i gives the i'th
+    /// Bernstein coefficient as a combination of the coefficients of the
+    /// B-splines with indices firstCoef(el), ..., firstCoef(el)+order-1.
+    const double* extractionOperator(int el) const
+    { return &operators_[op_index_[el]*order_*order_]; }
+
+    /// Apply the extraction operator of an element to a block of
+    /// coefficients in one parameter direction. The block is organized as
+    /// [nmb_after][order][nmb_before], with the coefficient index in this
+    /// direction in the middle. For a spline curve nmb_before is the
+    /// dimension of the coefficients, for the first direction of a surface
+    /// nmb_before is the dimension and nmb_after is the order in the second
+    /// parameter direction.
+    /// \param el the element
+    /// \param in B-spline coefficients of the element
+    /// \param nmb_before number of entries running faster than the
+    ///                   coefficient index in this direction
+    /// \param nmb_after number of entries running slower than the
+    ///                  coefficient index in this direction
+    /// \param out Bernstein coefficients, organized as the input. Must be
+    ///            different from in.
+    void apply(int el, const double* in, int nmb_before, int nmb_after,
+	       double* out) const;
+
+    /// Bernstein coefficients of a spline curve over one element. The
+    /// result has size order()*dim, where dim is the dimension of the curve
+    /// for polynomial curves and dimension+1 (homogeneous coordinates) for
+    /// rational curves.
+    void bernsteinCoefs(const SplineCurve& cv, int el,
+			std::vector<double>& bez) const;
+
+private:
+    int order_;
+    std::vector<double> knots_;  // Distinct knot values, numElements()+1
+    std::vector<int> left_;      // Knot index at start of each element
+    std::vector<int> op_index_;  // Operator index of each element
+    std::vector<double> operators_;  // Distinct operators
+};
+
+
+  /** Bezier extraction for a spline surface.
+   *
+   * Holds the extraction operators in both parameter directions, and
+   * extracts Bernstein patches and element bounding boxes from a surface
+   * defined on the same spline space. The extraction depends only on
+   * the knot vectors, and must be recomputed if the spline space of the
+   * surface is changed.
+   */
+
+class GO_API SurfaceBezierExtraction
+{
+public:
+    /// Constructs an empty extraction
+    SurfaceBezierExtraction();
+
+    /// Compute the extraction operators of the spline space of a surface
+    explicit SurfaceBezierExtraction(const SplineSurface& sf);
+
+    /// Compute the extraction operators of the spline space of a surface,
+    /// replacing current content
+    void setSurface(const SplineSurface& sf);
+
+    /// The extraction operators in one parameter direction
+    const BezierExtraction& extraction(int pardir) const
+    { return extraction_[pardir]; }
+
+    /// Number of elements in one parameter direction
+    int numElements(int pardir) const
+    { return extraction_[pardir].numElements(); }
+
+    /// Bernstein coefficients of the surface over the element (el_u, el_v).
+    /// The coefficients are stored with the first parameter direction
+    /// running fastest. For rational surfaces homogeneous coordinates are
+    /// returned.
+    void bernsteinPatch(const SplineSurface& sf, int el_u, int el_v,
+			std::vector<double>& bez) const;
+
+    /// Bounding box of the surface over one element, computed from the
+    /// Bernstein coefficients. This box is in general tighter than the box
+    /// of the B-spline coefficients influencing the element.
+    BoundingBox elementBoundingBox(const SplineSurface& sf,
+				   int el_u, int el_v) const;
+
+private:
+    BezierExtraction extraction_[2];
+};
+
+} // namespace Go
+
+#endif // _BEZIEREXTRACTION_H
+
@@ -264,6 +264,18 @@ namespace SplineUtils {
     void GO_API splineToBezierTransfMat(const double* knots,
 					std::vector<double>& transf_mat);
 
+    /// Create the transformation matrix which extracts the bezier coefs
+    /// from the B-spline coefs for the knot interval
+    /// (knots[order-1], knots[order]), for an arbitrary order.
+    /// The matrix is stored row by row with size order*order. Row i gives
+    /// the i'th Bernstein coefficient as a combination of the coefficients
+    /// of the order B-splines which are non-zero in the interval.
+    /// \param knots pointer to the knot vector, starting at the first
+    ///              knot of the first B-spline which is non-zero in the
+    ///              interval, i.e. 2*order knots are accessed.
+    void GO_API splineToBezierTransfMat(const double* knots, int order,
+					std::vector<double>& transf_mat);
+
     /// Assuming surface is bi-cubic (i.e. order 4).
     /// Extract the bezier patch corr to the domain
     /// (knots_u[ind_u_min], knots_u[int_u_min+1])x(knots_v[ind_v_min], knots_v[int_v_min+1]).
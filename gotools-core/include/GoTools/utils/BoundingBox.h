@@ -198,6 +198,28 @@ private:
 };
 
 
+/// Find all pairs of overlapping boxes in a set of boxes. The boxes
+/// are sorted on their start in the coordinate direction with the
+/// largest spread of the box centres and swept along this direction.
+/// \param boxes the set of boxes
+/// \param tol overlap tolerance, see BoundingBox::overlaps()
+/// \retval pairs indices of overlapping boxes, first index less
+/// than second index, sorted by the first and then the second index
+void GO_API overlappingBoxes(const std::vector<BoundingBox>& boxes,
+			    double tol, std::vector<std::pair<int, int> >& pairs);
+
+/// Find all pairs of overlapping boxes, one from each of two sets
+/// of boxes. The sets are swept together, see above.
+/// \param boxes1 the first set of boxes
+/// \param boxes2 the second set of boxes
+/// \param tol overlap tolerance, see BoundingBox::overlaps()
+/// \retval pairs indices of overlapping boxes in boxes1 and boxes2,
+/// sorted by the first and then the second index
+void GO_API overlappingBoxes(const std::vector<BoundingBox>& boxes1,
+			    const std::vector<BoundingBox>& boxes2,
+			    double tol, std::vector<std::pair<int, int> >& pairs);
+
+
 } // namespace Go
 
 
@@ -109,6 +109,47 @@ void object_from_stream(std::wistream& is, std::vector<T>& v)
   for (auto i = v.begin(); i != v.end(); ++i) { object_from_stream(is, *i);}
 }
 
+// =============================================================================
+// Binary storage of arrays of plain data, in the byte order of the machine
+// =============================================================================
+template <typename T> 
+void binary_to_stream(std::ostream& os, const T* data, size_t n)
+{
+  if (n > 0)
+    os.write(reinterpret_cast<const char*>(data), n*sizeof(T));
+}
+
+template <typename T> 
+void binary_from_stream(std::istream& is, T* data, size_t n)
+{
+  if (n > 0)
+    is.read(reinterpret_cast<char*>(data), n*sizeof(T));
+}
+
+template <typename T> void binary_to_stream(std::ostream& os, const T& obj) 
+{ binary_to_stream(os, &obj, 1); }
+
+template <typename T> void binary_from_stream(std::istream& is, T& obj) 
+{ binary_from_stream(is, &obj, 1); }
+
+// Whether n objects of type T may still be read from the stream. Used to
+// reject corrupt sizes before allocating storage for them. Streams that
+// cannot report their length are not checked
+template <typename T> 
+bool binary_fits_stream(std::istream& is, size_t n)
+{
+  if (!is)
+    return false;
+  std::streampos pos = is.tellg();
+  if (pos < 0)
+    return true;
+  is.seekg(0, std::ios::end);
+  std::streampos end = is.tellg();
+  is.seekg(pos);
+  if (end < 0)
+    return true;
+  return (n <= (size_t)(end - pos)/sizeof(T));
+}
 
 
 #endif
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _TETRAHEDRALPOLYEVALUATOR_H
+#define _TETRAHEDRALPOLYEVALUATOR_H
+
+
+#include "GoTools/implicitization/BernsteinTetrahedralPoly.h"
+#include "GoTools/utils/BaryCoordSystem.h"
+#include "GoTools/utils/Array.h"
+#include <vector>
+
+
+namespace Go {
+
+
+/**
+ * Fast evaluator for an implicit surface given as a
+ * BernsteinTetrahedralPoly in a barycentric coordinate system.
+ * On construction the polynomial is converted to monomial form in
+ * the local coordinates \f$(\beta_1, \beta_2, \beta_3)\f$, with
+ * \f$\beta_0 = 1 - \beta_1 - \beta_2 - \beta_3\f$, and the
+ * coefficients are stored contiguously in nested Horner order. The
+ * affine map from cartesian to local coordinates is precomputed, so
+ * no per-point allocation takes place.
+ * Points are given directly in cartesian coordinates, and the batch
+ * functions take the points as separate coordinate arrays
+ * (structure of arrays). The batch functions process the points in
+ * blocks with the point loop innermost, and distribute the blocks
+ * on threads when OpenMP is enabled.
+ * The result is equal to evaluating the BernsteinTetrahedralPoly in
+ * bc.cartToBary(pt), up to rounding errors.
+ */
+
+class TetrahedralPolyEvaluator {
+public:
+    /// Default constructor. The evaluator must be initialized by
+    /// setPolynomial() before use.
+    TetrahedralPolyEvaluator() : deg_(-1) { }
+    /// Constructor.
+    /// \param poly the implicit polynomial
+    /// \param bc the barycentric coordinate system in which poly is
+    /// defined
+    TetrahedralPolyEvaluator(const BernsteinTetrahedralPoly& poly,
+			     const BaryCoordSystem3D& bc)
+    { setPolynomial(poly, bc); }
+
+    /// Convert the polynomial to the internal evaluation layout.
+    /// \param poly the implicit polynomial
+    /// \param bc the barycentric coordinate system in which poly is
+    /// defined
+    void setPolynomial(const BernsteinTetrahedralPoly& poly,
+		       const BaryCoordSystem3D& bc);
+
+    /// Get the degree
+    /// \return the degree of the polynomial
+    int degree() const
+    { return deg_; }
+
+    /// Evaluate the polynomial in one point.
+    /// \param pt point in cartesian coordinates
+    /// \return the value of the polynomial in pt
+    double operator() (const Vector3D& pt) const;
+
+    /// Evaluate the polynomial and its cartesian gradient in one point.
+    /// \param pt point in cartesian coordinates
+    /// \retval val the value of the polynomial in pt
+    /// \retval grad the gradient of the polynomial in pt
+    void valueAndGradient(const Vector3D& pt,
+			  double& val, Vector3D& grad) const;
+
+    /// Evaluate the polynomial in a set of points.
+    /// \param num_pts number of points
+    /// \param x x-coordinates of the points, size num_pts
+    /// \param y y-coordinates of the points, size num_pts
+    /// \param z z-coordinates of the points, size num_pts
+    /// \retval val polynomial values, size num_pts
+    void evaluate(int num_pts, const double* x, const double* y,
+		  const double* z, double* val) const;
+
+    /// Evaluate the polynomial and its cartesian gradient in a set of
+    /// points.
+    /// \param num_pts number of points
+    /// \param x x-coordinates of the points, size num_pts
+    /// \param y y-coordinates of the points, size num_pts
+    /// \param z z-coordinates of the points, size num_pts
+    /// \retval val polynomial values, size num_pts
+    /// \retval grad_x x-component of the gradients, size num_pts
+    /// \retval grad_y y-component of the gradients, size num_pts
+    /// \retval grad_z z-component of the gradients, size num_pts
+    void evaluate(int num_pts, const double* x, const double* y,
+		  const double* z, double* val, double* grad_x,
+		  double* grad_y, double* grad_z) const;
+
+private:
+    int deg_;
+    // Monomial coefficients in nested Horner order: beta_3 outermost,
+    // beta_1 innermost, highest power first.
+    std::vector<double> coefs_;
+    // Local coordinates: beta_i = sum_d mat_[i-1][d]*(x_d - origin_[d])
+    double origin_[3];
+    double mat_[3][3];
+
+    // Evaluate a block of at most blocksize points
+    void evalBlock(int num, const double* x, const double* y,
+		   const double* z, double* val, double* grad_x,
+		   double* grad_y, double* grad_z) const;
+};
+
+
+} // namespace Go
+
+
+#endif // _TETRAHEDRALPOLYEVALUATOR_H
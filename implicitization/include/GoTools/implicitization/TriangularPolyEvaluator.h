@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _TRIANGULARPOLYEVALUATOR_H
+#define _TRIANGULARPOLYEVALUATOR_H
+
+
+#include "GoTools/implicitization/BernsteinTriangularPoly.h"
+#include "GoTools/utils/BaryCoordSystem.h"
+#include "GoTools/utils/Array.h"
+#include <vector>
+
+
+namespace Go {
+
+
+/**
+ * Fast evaluator for an implicit curve given as a
+ * BernsteinTriangularPoly in a barycentric coordinate system.
+ * The planar counterpart of TetrahedralPolyEvaluator: the polynomial
+ * is converted to monomial form in the local coordinates
+ * \f$(\beta_1, \beta_2)\f$, with \f$\beta_0 = 1 - \beta_1 - \beta_2\f$,
+ * and evaluated with a nested Horner scheme directly from cartesian
+ * coordinates. The batch functions take the points as separate
+ * coordinate arrays and are parallelized with OpenMP when enabled.
+ */
+
+class TriangularPolyEvaluator {
+public:
+    /// Default constructor. The evaluator must be initialized by
+    /// setPolynomial() before use.
+    TriangularPolyEvaluator() : deg_(-1) { }
+    /// Constructor.
+    /// \param poly the implicit polynomial
+    /// \param bc the barycentric coordinate system in which poly is
+    /// defined
+    TriangularPolyEvaluator(const BernsteinTriangularPoly& poly,
+			    const BaryCoordSystem2D& bc)
+    { setPolynomial(poly, bc); }
+
+    /// Convert the polynomial to the internal evaluation layout.
+    /// \param poly the implicit polynomial
+    /// \param bc the barycentric coordinate system in which poly is
+    /// defined
+    void setPolynomial(const BernsteinTriangularPoly& poly,
+		       const BaryCoordSystem2D& bc);
+
+    /// Get the degree
+    /// \return the degree of the polynomial
+    int degree() const
+    { return deg_; }
+
+    /// Evaluate the polynomial in one point.
+    /// \param pt point in cartesian coordinates
+    /// \return the value of the polynomial in pt
+    double operator() (const Vector2D& pt) const;
+
+    /// Evaluate the polynomial and its cartesian gradient in one point.
+    /// \param pt point in cartesian coordinates
+    /// \retval val the value of the polynomial in pt
+    /// \retval grad the gradient of the polynomial in pt
+    void valueAndGradient(const Vector2D& pt,
+			  double& val, Vector2D& grad) const;
+
+    /// Evaluate the polynomial in a set of points.
+    /// \param num_pts number of points
+    /// \param x x-coordinates of the points, size num_pts
+    /// \param y y-coordinates of the points, size num_pts
+    /// \retval val polynomial values, size num_pts
+    void evaluate(int num_pts, const double* x, const double* y,
+		  double* val) const;
+
+    /// Evaluate the polynomial and its cartesian gradient in a set of
+    /// points.
+    /// \param num_pts number of points
+    /// \param x x-coordinates of the points, size num_pts
+    /// \param y y-coordinates of the points, size num_pts
+    /// \retval val polynomial values, size num_pts
+    /// \retval grad_x x-component of the gradients, size num_pts
+    /// \retval grad_y y-component of the gradients, size num_pts
+    void evaluate(int num_pts, const double* x, const double* y,
+		  double* val, double* grad_x, double* grad_y) const;
+
+private:
+    int deg_;
+    // Monomial coefficients in nested Horner order: beta_2 outermost,
+    // beta_1 innermost, highest power first.
+    std::vector<double> coefs_;
+    // Local coordinates: beta_i = sum_d mat_[i-1][d]*(x_d - origin_[d])
+    double origin_[2];
+    double mat_[2][2];
+
+    // Evaluate a block of at most blocksize points
+    void evalBlock(int num, const double* x, const double* y,
+		   double* val, double* grad_x, double* grad_y) const;
+};
+
+
+} // namespace Go
+
+
+#endif // _TRIANGULARPOLYEVALUATOR_H
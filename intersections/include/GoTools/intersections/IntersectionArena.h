@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _INTERSECTIONARENA_H
+#define _INTERSECTIONARENA_H
+
+
+#include "GoTools/utils/config.h"
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <utility>
+
+
+namespace Go {
+
+
+/// Memory arena for the short-lived objects of one top-level
+/// intersection. The recursive intersectors create a large number of
+/// sub-intersectors, intersection pools, tolerance objects, boxes and
+/// sub-objects during subdivision. A top-level intersector creates an
+/// arena, which is handed on to its sub-intersectors and to the
+/// objects created by subdivision. These objects are allocated from
+/// large chunks of memory, with freed blocks recycled by size. The
+/// chunks are released in one go when the last object allocated from
+/// the arena is released.
+/// An arena is used by one thread at a time.
+
+class IntersectionArena {
+public:
+
+    /// Constructor
+    IntersectionArena();
+
+    /// Destructor. Releases all memory chunks.
+    ~IntersectionArena();
+
+    /// Allocate a memory block.
+    /// \param bytes the size of the block.
+    /// \return Pointer to the block.
+    void* allocate(size_t bytes);
+
+    /// Return a memory block to the arena.
+    /// \param ptr pointer to the block.
+    /// \param bytes the size of the block, as given to allocate().
+    void deallocate(void* ptr, size_t bytes);
+
+    /// Total size of the memory chunks held by the arena.
+    size_t chunkMemory() const
+    { return chunks_.size() * CHUNK_SIZE; }
+
+    /// The number of blocks handed out by the arena since it was
+    /// created, recycled blocks included.
+    size_t numAllocations() const
+    { return nmb_alloc_; }
+
+    /// The number of blocks currently in use.
+    size_t numBlocksInUse() const
+    { return nmb_in_use_; }
+
+    /// Create an object in the given arena. If the arena is empty,
+    /// the object is allocated on the heap.
+    template <class T, class... Args>
+    static shared_ptr<T> makeShared(const shared_ptr<IntersectionArena>& arena,
+				    Args&&... args);
+
+    /// Take ownership of an object allocated on the heap. The
+    /// reference count of the shared pointer is kept in the given
+    /// arena, if any.
+    template <class T>
+    static shared_ptr<T> adopt(const shared_ptr<IntersectionArena>& arena,
+			       T* ptr);
+
+private:
+    enum { GRANULE = 16, NUM_CLASSES = 64, CHUNK_SIZE = 65536 };
+
+    std::vector<char*> chunks_;
+    char* next_;
+    char* end_;
+    void* free_[NUM_CLASSES];   // Lists of freed blocks for each size class
+    size_t nmb_alloc_;
+    size_t nmb_in_use_;
+
+    IntersectionArena(const IntersectionArena&);
+    IntersectionArena& operator=(const IntersectionArena&);
+};
+
+
+/// Standard allocator handing out memory from an IntersectionArena.
+/// The allocator shares the ownership of the arena, thus the arena
+/// lives as long as any object allocated from it.
+template <class T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    explicit ArenaAllocator(const shared_ptr<IntersectionArena>& arena)
+	: arena_(arena) {}
+
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other)
+	: arena_(other.arena()) {}
+
+    T* allocate(size_t n)
+    { return static_cast<T*>(arena_->allocate(n * sizeof(T))); }
+
+    void deallocate(T* ptr, size_t n)
+    { arena_->deallocate(ptr, n * sizeof(T)); }
+
+    const shared_ptr<IntersectionArena>& arena() const
+    { return arena_; }
+
+    template <class U>
+    struct rebind { typedef ArenaAllocator<U> other; };
+
+private:
+    shared_ptr<IntersectionArena> arena_;
+};
+
+template <class T, class U>
+inline bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{ return a.arena() == b.arena(); }
+
+template <class T, class U>
+inline bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{ return a.arena() != b.arena(); }
+
+
+//===========================================================================
+template <class T, class... Args>
+shared_ptr<T> 
+IntersectionArena::makeShared(const shared_ptr<IntersectionArena>& arena,
+			      Args&&... args)
+//===========================================================================
+{
+    if (arena.get() == 0)
+	return shared_ptr<T>(new T(std::forward<Args>(args)...));
+    return std::allocate_shared<T>(ArenaAllocator<T>(arena),
+				   std::forward<Args>(args)...);
+}
+
+
+//===========================================================================
+template <class T>
+shared_ptr<T> IntersectionArena::adopt(const shared_ptr<IntersectionArena>& arena,
+				       T* ptr)
+//===========================================================================
+{
+    if (arena.get() == 0)
+	return shared_ptr<T>(ptr);
+    return shared_ptr<T>(ptr, std::default_delete<T>(), 
+			 ArenaAllocator<T>(arena));
+}
+
+
+} // namespace Go
+
+
+#endif // _INTERSECTIONARENA_H
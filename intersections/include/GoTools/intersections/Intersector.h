@@ -58,6 +58,8 @@ class IntersectionPoint;
 class IntersectionCurve;
 class IntersectionPool;
 class GeoTol;
+class IntersectionArena;
+class ParamObjectInt;
 struct BoundaryGeomInt;
 
 
@@ -70,12 +72,16 @@ public:
     /// Default constructor
     Intersector() : prev_intersector_(0) {}
 
-    /// Constructor.
+    /// Constructor. A top-level intersector, without a previous
+    /// intersector, creates the memory arena of the intersection.
+    /// Otherwise the arena of the previous intersector is used.
     /// \param epsge the geometric tolerance for the intersector.
     /// \param prev the previous intersector.
     Intersector(double epsge, Intersector *prev = 0);
 
-    /// Constructor.
+    /// Constructor. A top-level intersector, without a previous
+    /// intersector, creates the memory arena of the intersection.
+    /// Otherwise the arena of the previous intersector is used.
     /// \param epsge the geometric tolerance for the intersector.
     /// \param prev the previous intersector.
     Intersector(shared_ptr<GeoTol> epsge, Intersector *prev = 0);
@@ -115,6 +121,13 @@ public:
     shared_ptr<GeoTol> getTolerance()
     { return epsge_;}
 
+    /// Get the memory arena in which the sub-intersectors, the
+    /// intersection pools and the subdivided objects of this
+    /// intersection are allocated.
+    /// \return The arena of the top-level intersector.
+    shared_ptr<IntersectionArena> getArena()
+    { return arena_; }
+
     /// Verify whether singularities has been set.
     /// \return True if info on singularities has been set.
     bool hasSingularityInfo()
@@ -217,6 +230,7 @@ protected:
     shared_ptr<IntersectionPool> int_results_;
     std::vector<shared_ptr<Intersector> > sub_intersectors_;
     Intersector *prev_intersector_;
+    shared_ptr<IntersectionArena> arena_;
     shared_ptr<GeoTol> epsge_;
     shared_ptr<SingularityInfo> singularity_info_;
     shared_ptr<ComplexityInfo> complexity_info_;
@@ -228,6 +242,11 @@ protected:
     // 			    int eliminated_parameter = -1,
     // 			    double eliminated_value = 0) = 0;
 
+    // Let the objects resulting from subdivision of an object given
+    // to the top-level intersector, and thus without an arena, use the
+    // arena of this intersection for their own sub-objects
+    void useArena(ParamObjectInt* obj) const;
+
     virtual void print_objs() = 0;
 
     virtual int getBoundaryIntersections() = 0;
@@ -50,6 +50,7 @@ namespace Go {
 
 
 class CompositeBox;
+class IntersectionArena;
 class ParamPointInt;
 class ParamCurveInt;
 class ParamSurfaceInt;
@@ -62,8 +63,13 @@ class ParamObjectInt : public GeomObjectInt {
 public:
     /// Constructor.
     /// \param parent is a parametric object for which this object
-    /// constitues only a subpart (0 if there is no parent).
-    ParamObjectInt(ParamObjectInt* parent = 0) : parent_(parent) {}
+    /// constitues only a subpart (0 if there is no parent). The
+    /// object is given the memory arena of the parent.
+    ParamObjectInt(ParamObjectInt* parent = 0) : parent_(parent)
+    {
+	if (parent_)
+	    arena_ = parent_->arena_;
+    }
     
     /// Destructor.
     virtual ~ParamObjectInt() {}
@@ -208,6 +214,18 @@ public:
     ParamObjectInt* getParent() const 
     { return parent_; }
 
+    /// Set the memory arena in which the sub-objects of this object
+    /// are allocated.
+    /// \param arena the arena of the intersection that subdivides
+    /// this object.
+    void setArena(const shared_ptr<IntersectionArena>& arena)
+    { arena_ = arena; }
+
+    /// Return the memory arena of this object. Empty if the
+    /// sub-objects are allocated on the heap.
+    const shared_ptr<IntersectionArena>& getArena() const
+    { return arena_; }
+
     /// Return the CompositeBox for the parametric object.
     virtual CompositeBox compositeBox() const = 0;
 
@@ -237,6 +255,7 @@ public:
 protected:
 
     ParamObjectInt* parent_;
+    shared_ptr<IntersectionArena> arena_;
 
 };
 
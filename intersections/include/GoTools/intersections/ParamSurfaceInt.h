@@ -319,11 +319,17 @@ public:
 		double to_upar, double to_vpar,
 		double fuzzy);
 
-    /// Create the CompositeBox for the parametric object.
+    /// Create the CompositeBox for the parametric object. The box of
+    /// an object created by subdivision is computed when the object
+    /// is made, otherwise at the first call, and kept for the lifetime
+    /// of the object. The cached box is not protected against
+    /// concurrent access: an object must not be shared between threads.
     /// \return The CompositeBox for the parametric object.
     virtual CompositeBox compositeBox() const;
 
-    /// A cone which contains all normals of the object.
+    /// A cone which contains all normals of the object. The cone is
+    /// computed at the first call and kept for the lifetime of the
+    /// object. As for the box, the cached cone is not thread safe.
     /// \return A cone which contains all normals of the object.
     virtual DirectionCone directionCone() const;
 
@@ -678,7 +684,9 @@ protected:
     mutable int nmesh_[2];
     mutable std::vector<double> mesh_;
 
+    // Lazily computed caches. Not thread safe
     mutable DirectionCone cone_;
+    mutable shared_ptr<CompositeBox> box_;
 
     mutable bool lw_set_;
     mutable double length_[2], wiggle_[2];
@@ -111,8 +111,12 @@ protected:
 			    int eliminated_parameter = -1,
 			    double eliminated_value = 0);
 
+    virtual int performInterception();
+
     virtual int performRotatedBoxTest(double eps1, double eps2);
 
+    bool separatedBySlab(double eps);
+
     virtual bool foundIntersectionNearBoundary();
 
     virtual int performInterceptionByImplicitization();
@@ -128,7 +128,9 @@ public:
     /// Return the geometric sample mesh for the parametric function.
     virtual std::vector<double>::iterator getMesh();
 
-    /// A cone which contains all normals of the object.
+    /// A cone which contains all normals of the object. The cone and
+    /// the normal surface are computed at the first call and kept. The
+    /// cache is not thread safe.
     /// \return A cone which contains all normals of the object.
     virtual DirectionCone directionCone() const;    
 
@@ -209,6 +211,13 @@ public:
     /// \return The rotated box
     virtual RotatedBox getRotatedBox(std::vector<Point>& axis) const;
 
+    /// Compute the extent of the control polygon along a direction,
+    /// i.e. a slab containing the surface.
+    /// \param dir the direction of the slab, of unit length.
+    /// \param low the smallest projection of a coefficient onto dir.
+    /// \param high the largest projection of a coefficient onto dir.
+    void directionExtent(const Point& dir, double& low, double& high) const;
+
     /// Requests from selfintersection computation.  Split at G1
     /// discontinuities.
     /// \param angtol angular tolerance defining G1 discontinuity
@@ -129,6 +129,17 @@ namespace Go
     // Fetch all the single block defining this multi-block model
     void getIsogeometricBlocks(std::vector<shared_ptr<IsogeometricVolBlock> >& volblock);
 
+    // Pre evaluate basis functions for one solution space in all blocks.
+    // Gauss_par[i] holds the Gauss parameters of block number i in the three
+    // parameter directions, see VolSolution::performPreEvaluation().
+    // The blocks are independent and are processed in parallel when OpenMP
+    // is enabled
+    void performPreEvaluation(int solutionspace_idx,
+			      std::vector<std::vector<std::vector<double> > >& Gauss_par);
+
+    // Release scratch related to pre evaluated basis functions in all blocks
+    void erasePreEvaluatedBasisFunctions();
+
   private:
     // The blocks which this block structured model consist of
     std::vector<shared_ptr<IsogeometricVolBlock> > vol_blocks_;
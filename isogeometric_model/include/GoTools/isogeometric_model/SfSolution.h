@@ -229,6 +229,33 @@ namespace Go
 				std::vector<double>& basisDerivs_u,
 				std::vector<double>& basisDerivs_v) const;
 
+    // Compute the element mass and stiffness (Laplace) matrices of the
+    // solution basis over one element, given by the knot interval indices.
+    // Gauss_wgt contains the quadrature weights corresponding to the Gauss
+    // parameters given to performPreEvaluation().
+    // The matrices are dense, of size nb*nb where nb = order_u*order_v,
+    // stored row by row with the local basis functions ordered with the
+    // first parameter direction running fastest. dof_index gives the global
+    // index of the local basis functions.
+    // The integrals are computed by sum factorization over the tensor
+    // product structure of the basis.
+    // Requires pre evaluation to be performed
+    void getElementMatrices(int knot_ind_u, int knot_ind_v,
+			    const std::vector<std::vector<double> >& Gauss_wgt,
+			    std::vector<double>& mass,
+			    std::vector<double>& stiffness,
+			    std::vector<int>& dof_index) const;
+
+    // Compute the element load vector of a source term given as a functor
+    // of the geometry position, over one element. The result has size
+    // nb*dimension(). See also getElementMatrices().
+    // Requires pre evaluation to be performed
+    void getElementLoadVector(int knot_ind_u, int knot_ind_v,
+			      const std::vector<std::vector<double> >& Gauss_wgt,
+			      BdCondFunctor* source,
+			      std::vector<double>& load,
+			      std::vector<int>& dof_index) const;
+
     // Return the value of the Jacobian determinant of the parameterization in a specified Gauss point.
     // Requires pre evaluation to be performed
     virtual double getJacobian(std::vector<int>& index_of_Gauss_point) const;
@@ -311,6 +338,21 @@ namespace Go
     // Pointer to the block to which this boundary condition belongs
     IsogeometricSfBlock* parent_;
 
+    // Indices of the Gauss points inside a given element, and the global
+    // indices of the basis functions that are non-zero in the element
+    void elementGaussPoints(int knot_ind_u, int knot_ind_v,
+			    std::vector<int>& index_of_Gauss_points1,
+			    std::vector<int>& index_of_Gauss_points2,
+			    std::vector<int>& dof_index) const;
+
+    // Quadrature weight times area element and inverse metric tensor
+    // (3 entries per point: 00, 11, 01) in the Gauss points of an element
+    void elementGeometry(const std::vector<int>& index_of_Gauss_points1,
+			 const std::vector<int>& index_of_Gauss_points2,
+			 const std::vector<std::vector<double> >& Gauss_wgt,
+			 std::vector<double>& weight,
+			 std::vector<double>& metric) const;
+
     // Get information about alle neighbouring edges to another
     // block solution, and if the spline spaces match
     void neighbourInfo(BlockSolution* other, std::vector<int>& edges, std::vector<int>& edges_other,
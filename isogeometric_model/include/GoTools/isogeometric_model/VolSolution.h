@@ -70,12 +70,16 @@ namespace Go
     std::vector<int>    left_v_;      // Index of first non-zero basis function in 2. par. dir.
     std::vector<int>    left_w_;      // Index of first non-zero basis function in 3. par. dir.
 
-    // Storage for grid evaluation of the geometry surface
-    // Sizes: gauss_par1_.size() * gauss_par1_.size() * gauss_par1_.size() * dim.
-    std::vector<double> points_;   // Position of the surface in the Gauss points.
-    std::vector<double> deriv_u_;  // 1. derivative of the surface in 1. par. dir. in the Gauss points
-    std::vector<double> deriv_v_;  // 1. derivative of the surface in 2. par. dir. in the Gauss points
-    std::vector<double> deriv_w_;  // 1. derivative of the surface in 3. par. dir. in the Gauss points
+    // Storage for the geometry volume. Only the univariate basis values are
+    // stored, position and derivatives in a Gauss point are combined from
+    // these tables on request. Storing the full grid would require
+    // gauss_par1_.size() * gauss_par2_.size() * gauss_par3_.size() * 4 * dim doubles.
+    std::vector<double> geo_basisvals_u_; // Non-zero geometry basis functions and derivatives, 1. par.dir
+    std::vector<double> geo_basisvals_v_; // Non-zero geometry basis functions and derivatives, 2. par.dir
+    std::vector<double> geo_basisvals_w_; // Non-zero geometry basis functions and derivatives, 3. par.dir
+    std::vector<int>    geo_left_u_;      // Index of first non-zero geometry basis function, 1. par. dir.
+    std::vector<int>    geo_left_v_;      // Index of first non-zero geometry basis function, 2. par. dir.
+    std::vector<int>    geo_left_w_;      // Index of first non-zero geometry basis function, 3. par. dir.
   };
 
   // This class represents one solution in one block in a block-structured
@@ -191,6 +195,8 @@ namespace Go
     // is so high that it creates a C0 surface
     // NB! Refinement of the spline space or degree elvation will imply that the
     // pre evaluated values are removed, and this function must be called again
+    // Only univariate tables are stored, and the parameter directions are
+    // evaluated concurrently when OpenMP is enabled
     virtual void performPreEvaluation(std::vector<std::vector<double> >& Gauss_par);
 
     // Get value and 1. derivative of all non-zero rational basis funtions
@@ -218,6 +224,59 @@ namespace Go
 			   vector<double>& basisDerivs_w) const;
 //			   shared_ptr<BasisDerivs> result) const;
 
+    // Get value and 1. derivative of all non-zero basis functions in all
+    // Gauss points inside one element, given by the knot interval indices
+    // (as returned by BsplineBasis::knotInterval()). The Gauss points in
+    // the element are returned as index ranges in each parameter direction.
+    // The output vectors are organized as one block of
+    // order_u*order_v*order_w values per Gauss point, with the Gauss points
+    // running fastest in the first parameter direction. The blocks are
+    // combined from the pre evaluated univariate tables.
+    // Requires pre evaluation to have been performed.
+    void getElementBasisFunctions(int knot_ind_u,
+				  int knot_ind_v,
+				  int knot_ind_w,
+				  std::vector<int>& index_of_Gauss_points1,
+				  std::vector<int>& index_of_Gauss_points2,
+				  std::vector<int>& index_of_Gauss_points3,
+				  std::vector<double>& basisValues,
+				  std::vector<double>& basisDerivs_u,
+				  std::vector<double>& basisDerivs_v,
+				  std::vector<double>& basisDerivs_w) const;
+
+    // Compute the element mass and stiffness (Laplace) matrices of the
+    // solution basis over one element, given by the knot interval indices.
+    // Gauss_wgt contains the quadrature weights corresponding to the Gauss
+    // parameters given to performPreEvaluation().
+    // The matrices are dense, of size nb*nb where nb = order_u*order_v*order_w,
+    // stored row by row with the local basis functions ordered as in
+    // getElementBasisFunctions(). dof_index gives the global index of the
+    // local basis functions in the enumeration of the solution coefficients.
+    // The integrals are computed by sum factorization over the tensor
+    // product structure of the basis.
+    // Requires pre evaluation to have been performed.
+    void getElementMatrices(int knot_ind_u,
+			    int knot_ind_v,
+			    int knot_ind_w,
+			    const std::vector<std::vector<double> >& Gauss_wgt,
+			    std::vector<double>& mass,
+			    std::vector<double>& stiffness,
+			    std::vector<int>& dof_index) const;
+
+    // Compute the element load vector of a source term given as a functor
+    // of the geometry position, over one element. The functor must return a
+    // point of the same dimension as the solution. The result has size
+    // nb*dimension(), with one entry per solution component for each local
+    // basis function. See also getElementMatrices().
+    // Requires pre evaluation to have been performed.
+    void getElementLoadVector(int knot_ind_u,
+			      int knot_ind_v,
+			      int knot_ind_w,
+			      const std::vector<std::vector<double> >& Gauss_wgt,
+			      BdCondFunctor* source,
+			      std::vector<double>& load,
+			      std::vector<int>& dof_index) const;
+
     // Get value and 1. derivative at all Gauss points in the support
     // of the basis function. Assuming that the input vectors are
     // empty.
@@ -343,6 +402,42 @@ namespace Go
     // Pointer to the block to which this boundary condition belongs
     IsogeometricVolBlock* parent_;
 
+    // Position and 1. derivatives of the geometry volume in a Gauss point,
+    // computed from the pre evaluated geometry basis. The result is stored
+    // as position, derivative in u, v and w, each of the geometry dimension.
+    // work is scratch space of size at least 9*(dim+1), given by the caller
+    // so that it can be reused between Gauss points
+    void geometryInGaussPoint(int index_of_Gauss_point1,
+			      int index_of_Gauss_point2,
+			      int index_of_Gauss_point3,
+			      double* result, double* work) const;
+
+    // Indices of the Gauss points inside a given element
+    void elementGaussPoints(int knot_ind_u,
+			    int knot_ind_v,
+			    int knot_ind_w,
+			    std::vector<int>& index_of_Gauss_points1,
+			    std::vector<int>& index_of_Gauss_points2,
+			    std::vector<int>& index_of_Gauss_points3) const;
+
+    // Global indices of the basis functions that are non-zero in an element
+    void elementDofs(int knot_ind_u,
+		     int knot_ind_v,
+		     int knot_ind_w,
+		     std::vector<int>& dof_index) const;
+
+    // Quadrature weight times volume element, inverse metric tensor
+    // (6 entries per point: 00, 11, 22, 01, 02, 12) and geometry position in
+    // the Gauss points of an element, with the first parameter direction
+    // running fastest
+    void elementGeometry(const std::vector<int>& index_of_Gauss_points1,
+			 const std::vector<int>& index_of_Gauss_points2,
+			 const std::vector<int>& index_of_Gauss_points3,
+			 const std::vector<std::vector<double> >& Gauss_wgt,
+			 std::vector<double>& weight,
+			 std::vector<double>& metric,
+			 std::vector<double>& position) const;
+
     void neighbourInfo(BlockSolution* other, vector<int>& faces, vector<int>& faces_other,
 		       vector<int>& orientation, vector<bool>& same_dir_order,
 		       vector<bool>& space_matches) const;
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef __SOLUTIONTESTUTILS_H
+#define __SOLUTIONTESTUTILS_H
+
+// Shared fixtures of the SfSolution and VolSolution unit tests
+
+#include "GoTools/isogeometric_model/BdCondFunctor.h"
+#include "GoTools/geometry/BsplineBasis.h"
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+
+// Knot vector with two elements on [0,1], and the Greville abscissae
+inline void twoElementKnots(int ord, std::vector<double>& knots,
+			    std::vector<double>& greville)
+{
+    knots.assign(ord, 0.0);
+    knots.push_back(0.5);
+    knots.insert(knots.end(), ord, 1.0);
+    greville.resize(ord + 1);
+    for (int ki = 0; ki <= ord; ++ki)
+    {
+	greville[ki] = 0.0;
+	for (int kj = 1; kj < ord; ++kj)
+	    greville[ki] += knots[ki+kj];
+	greville[ki] /= (double)std::max(ord - 1, 1);
+    }
+}
+
+
+// Three Gauss points in each element of the basis, with the quadrature
+// weights scaled to the element length
+inline void gaussParameters(const Go::BsplineBasis& basis,
+			    std::vector<double>& par, std::vector<double>& wgt)
+{
+    const double gp[3] = {-sqrt(0.6), 0.0, sqrt(0.6)};
+    const double gw[3] = {5.0/9.0, 8.0/9.0, 5.0/9.0};
+    std::vector<double> knots;
+    basis.knotsSimple(knots);
+    par.clear();
+    wgt.clear();
+    for (size_t ki = 1; ki < knots.size(); ++ki)
+	for (int kj = 0; kj < 3; ++kj)
+	{
+	    par.push_back(0.5*(knots[ki-1] + knots[ki])
+			  + 0.5*gp[kj]*(knots[ki] - knots[ki-1]));
+	    wgt.push_back(0.5*gw[kj]*(knots[ki] - knots[ki-1]));
+	}
+}
+
+
+// Source term equal to the first geometry coordinate
+class CoordinateSource : public Go::BdCondFunctor
+{
+public:
+    virtual Go::Point evaluate(const Go::Point& geom_pos)
+    {
+	Go::Point val(1);
+	val[0] = geom_pos[0];
+	return val;
+    }
+};
+
+
+#endif    // #ifndef __SOLUTIONTESTUTILS_H
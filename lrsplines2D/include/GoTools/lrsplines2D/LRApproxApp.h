@@ -85,6 +85,25 @@ namespace Go
 			   double& avdist_out, int& nmb_out,
 			   int mba=1, int tomba=0);
 
+    /// Approximate a large point cloud (parameter pair + height) by a
+    /// regular grid of nmb_u x nmb_v LR B-spline surfaces covering domain.
+    /// The tiles are approximated concurrently, each one from the points
+    /// in the tile domain extended by the fraction 'overlap' of the tile
+    /// size in each direction, and restricted to the tile domain afterwards.
+    /// Only the points of the tiles being processed are copied. The
+    /// surfaces are stitched by LRSurfStitch with C0 (cont=0) or C1 (cont=1)
+    /// continuity and returned ordered from bottom to top and from left to
+    /// right. A tile without points gives an empty surface pointer.
+    /// The accuracy information is computed from the stitched surfaces.
+    /// The points are reordered tile by tile.
+    void pointCloud2SplineTiled(std::vector<double>& points, double domain[],
+				int nmb_u, int nmb_v, double overlap,
+				double eps, int max_iter, int cont,
+				std::vector<shared_ptr<LRSplineSurface> >& surfs,
+				double& maxdist, double& avdist, 
+				double& avdist_out, int& nmb_out,
+				int mba=0, int initmba=1, int tomba=5);
+
     /// Compute point cloud distance with respect to an LR B-spline surface
     void computeDistPointSpline(std::vector<double>& points,
 				shared_ptr<LRSplineSurface>& surf,
@@ -113,13 +132,17 @@ namespace Go
     /// Compute point cloud distance with respect to an LR B-spline surface
     /// and group points according to this distances
     /// Multi-threaded version
+    /// If element_sharded is true, the points are bucketed by element and
+    /// the elements are processed in parallel. The points are not reordered,
+    /// and the points of each group are given in the input order
     void classifyCloudFromDist_omp(std::vector<double>& points,
 				   shared_ptr<LRSplineSurface>& surf,
 				   std::vector<double>& limits,
 				   double& max_above, double& max_below, 
 				   double& avdist, int& nmb_points,
 				   std::vector<std::vector<double> >& level_points,
-				   std::vector<int>& nmb_group);
+				   std::vector<int>& nmb_group,
+				   bool element_sharded = false);
 
     /// Compute point cloud distance with respect to an LR B-spline surface
     /// and classify each point according to this distances
@@ -135,13 +158,17 @@ namespace Go
     /// Compute point cloud distance with respect to an LR B-spline surface
     /// and classify each point according to this distances
     /// Multi-threaded version
+    /// If element_sharded is true, the points are bucketed by element and
+    /// the elements are processed in parallel. The points are not reordered,
+    /// and classification follows the input order
     void categorizeCloudFromDist_omp(std::vector<double>& points,
 				     shared_ptr<LRSplineSurface>& surf,
 				     std::vector<double>& limits,
 				     double& max_above, double& max_below, 
 				     double& avdist, int& nmb_points,
 				     std::vector<int>& classification,
-				     std::vector<int>& nmb_group);
+				     std::vector<int>& nmb_group,
+				     bool element_sharded = false);
   };
 };
 
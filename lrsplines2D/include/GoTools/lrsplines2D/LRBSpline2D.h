@@ -191,6 +191,15 @@ class LRBSpline2D : public Streamable
 			const std::vector<double>& parval, 
 			std::vector<double>& derivs) const;
 
+  /// Evaluate the univariate B-spline of the given parameter direction,
+  /// and its derivatives up to order nmb_der, in nmb_par parameter values.
+  /// The output contains nmb_der+1 values for each parameter value, the
+  /// value first. Parameter values at the end of the support are treated
+  /// as in eval(). The values are not multiplied by gamma or the
+  /// coefficient, and rationals are NOT handled.
+  void evalUnivariate(Direction2D d, int nmb_der, int nmb_par,
+		      const double* parval, double* result) const;
+
   // -----------------------
   // --- QUERY FUNCTIONS ---
   // -----------------------
@@ -344,6 +353,16 @@ class LRBSpline2D : public Streamable
   /// \return          a vector of the coefficients of the control points p_ij in order p_00[0], p_00[1], ..., p_10[0], ..., p_01[0], ...
   std::vector<double> unitSquareBernsteinBasis(double start_u, double stop_u, double start_v, double stop_v) const;
 
+  /// For a given interval inside one of the segments in the knot vector of a given direction, the
+  /// univariate B-spline in the direction is a polynomial. After transforming the rectangle to the
+  /// unit square, this polynomial can be expressed by the Bernstein basis.
+  /// This function returns the coefficients for this expression.
+  /// \param start     the minimum value of the given interval
+  /// \param stop      the maximum value of the given interval
+  /// \param d         the direction (XFIXED for first parameter, YFIXED for second parameter)
+  /// \return          a vector with the coefficients
+  std::vector<double> unitIntervalBernsteinBasis(double start, double stop, Direction2D d) const;
+
  private:
 
   Point coef_times_gamma_;
@@ -359,16 +378,6 @@ class LRBSpline2D : public Streamable
   // Used in least squares approximation with smoothing
   int coef_fixed_;  // 0=free coefficients, 1=fixed, 2=not affected
 
-  /// For a given interval inside one of the segments in the knot vector of a given direction, the
-  /// univariate B-spline in the direction is a polynomial. After transforming the rectangle to the
-  /// unit square, this polynomial can be expressed by the Bernstein basis.
-  /// This function returns the coefficients for this expression.
-  /// \param start     the minimum value of the given interval
-  /// \param stop      the maximum value of the given interval
-  /// \param d         the direction (XFIXED for first parameter, YFIXED for second parameter)
-  /// \return          a vector with the coefficients
-  std::vector<double> unitIntervalBernsteinBasis(double start, double stop, Direction2D d) const;
-
 }; // end class LRBSpline2D
 
  inline std::ostream& operator<<(std::ostream& os, const LRBSpline2D& b) {b.write(os); return os;}
@@ -100,6 +100,16 @@ bool try_split_once(const LRBSpline2D& b, const Mesh2D& mesh,
 		    LRBSpline2D*& b1, 
 		    LRBSpline2D*& b2);
 
+// If 'b' can be split in the mesh 'm', insert all knots missing from 'b' in
+// one parameter direction at once, and return the resulting B-splines in 
+// 'split'.  The first direction with missing knots is used, as in 
+// try_split_once(). The result is the same as repeated calls to 
+// try_split_once() followed by merging of identical B-splines, but no 
+// intermediate B-splines are generated.
+// Memory must be handled on the outside of the function.
+bool try_split_all(const LRBSpline2D& b, const Mesh2D& mesh, 
+		   std::vector<LRBSpline2D*>& split);
+
 
 #if 0
 // Comparison functor which only takes into account the support of the LRBSpline2Ds, 
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _LRBEZIEREXTRACTION_H
+#define _LRBEZIEREXTRACTION_H
+
+#include "GoTools/lrsplines2D/LRSplineSurface.h"
+#include "GoTools/lrsplines2D/Element2D.h"
+#include "GoTools/lrsplines2D/LRBSpline2D.h"
+#include "GoTools/utils/BoundingBox.h"
+
+#include <vector>
+
+
+namespace Go
+{
+
+// =============================================================================
+/// Bezier extraction for an LR spline surface.
+/// For every element, the LR B-splines with support in the element are
+/// expressed in the Bernstein basis of bi-degree (degree_u, degree_v) over
+/// the element. The extraction operators are computed once, and elements
+/// where the supporting B-splines have the same local knot configuration
+/// relative to the element share storage. The extraction is invalidated by
+/// refinement of the surface, while changes of the coefficients only are
+/// allowed.
+class LRBezierExtraction
+// =============================================================================
+{
+public:
+  /// Constructs an empty extraction
+  LRBezierExtraction();
+
+  /// Compute the extraction operators of all elements of a surface
+  explicit LRBezierExtraction(const LRSplineSurface& surf);
+
+  /// Compute the extraction operators of all elements of a surface,
+  /// replacing current content
+  void setSurface(const LRSplineSurface& surf);
+
+  /// Degree of the Bernstein basis in the given parameter direction
+  int degree(Direction2D d) const
+  { return (d == XFIXED) ? deg_u_ : deg_v_; }
+
+  /// Number of elements. The elements are numbered in the order of the
+  /// element map of the surface
+  int numElements() const
+  { return (int)elements_.size(); }
+
+  /// Access an element
+  const Element2D* element(int el) const
+  { return elements_[el]; }
+
+  /// Number of distinct extraction operators
+  int numOperators() const
+  { return (int)operators_.size(); }
+
+  /// Index of the extraction operator of an element among the distinct
+  /// operators
+  int operatorIndex(int el) const
+  { return op_index_[el]; }
+
+  /// The LR B-splines with support in an element, in the order of the
+  /// rows of the extraction operator
+  const std::vector<LRBSpline2D*>& support(int el) const
+  { return support_[el]; }
+
+  /// The extraction operator of an element. The operator is a matrix with
+  /// one row for each B-spline in support(el), and (degree_u+1)*(degree_v+1)
+  /// columns, stored row by row. Row k gives the coefficients of the k'th
+  /// B-spline, without the scaling factor gamma, in the Bernstein basis over
+  /// the element, with the first parameter direction running fastest.
+  const double* extractionOperator(int el) const
+  { return &operators_[op_index_[el]][0]; }
+
+  /// Bernstein coefficients of the surface over one element. The
+  /// coefficients are stored with the first parameter direction running
+  /// fastest. For rational surfaces homogeneous coordinates are returned.
+  void bernsteinPatch(int el, std::vector<double>& bez) const;
+
+  /// Bounding box of the surface over one element, computed from the
+  /// Bernstein coefficients
+  BoundingBox elementBoundingBox(int el) const;
+
+private:
+  int deg_u_;
+  int deg_v_;
+  int dim_;
+  bool rational_;
+  std::vector<const Element2D*> elements_;
+  std::vector<std::vector<LRBSpline2D*> > support_;
+  std::vector<int> op_index_;
+  std::vector<std::vector<double> > operators_;
+};
+
+} // end namespace Go
+
+#endif // _LRBEZIEREXTRACTION_H
+
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef LRRASTERUTILS_H
+#define LRRASTERUTILS_H
+
+#include "GoTools/geometry/ParamSurface.h"
+#include <iostream>
+
+namespace Go
+{
+  namespace LRRasterUtils
+  {
+    /// Write the header of an ESRI binary float grid. Cell (i,j), 
+    /// counted from the lower left corner of the raster, has centre 
+    /// (x0 + i*cellsize, y0 + j*cellsize). The header applies to both
+    /// the height raster and the error raster written by writeRaster().
+    void writeRasterHeader(double x0, double y0, double cellsize,
+			   int ncols, int nrows, double nodata,
+			   std::ostream& hdr);
+
+    /// Evaluate a height surface in the cell centres of a raster and
+    /// write the heights as 32 bit floats, one row at the time starting
+    /// with the upper row, as in an ESRI binary float grid. The surface
+    /// is an LRSplineSurface of dimension one, or a BoundedSurface with
+    /// such an underlying surface. Cells outside the surface domain or
+    /// the trimmed region are given the nodata value. The raster is
+    /// computed in bands of band_rows rows. In each band, the surface is
+    /// evaluated element by element in parallel, and the full raster is
+    /// never stored.
+    /// If err is given, the maximum distance between the surface and the
+    /// data points stored in the elements is written for each cell, in
+    /// the same layout. Cells without data points are given the nodata
+    /// value.
+    void writeRaster(shared_ptr<ParamSurface> surf,
+		     double x0, double y0, double cellsize,
+		     int ncols, int nrows, double nodata,
+		     std::ostream& data, std::ostream* err = 0,
+		     int band_rows = 64);
+
+  }; // end namespace LRRasterUtils
+
+}; // end namespace Go
+
+#endif
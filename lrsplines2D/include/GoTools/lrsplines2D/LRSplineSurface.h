@@ -208,6 +208,15 @@ namespace Go
   virtual void  read(std::istream& is);       
   virtual void write(std::ostream& os) const; 
 
+  // Binary storage. The mesh knot values and multiplicities are stored once,
+  // followed by the knot indices of all LR B-splines as packed arrays and
+  // the scaling factors and coefficients as contiguous arrays. The data is
+  // stored in the byte order of the machine, and reading a file of the
+  // other byte order throws. The element map is rebuilt when reading, with
+  // the elements of the LR B-splines identified in parallel.
+  void readBinary(std::istream& is);
+  void writeBinary(std::ostream& os) const;
+
   // ----------------------------------------------------
   // Inherited from GeomObject
   // ----------------------------------------------------
@@ -295,6 +304,24 @@ namespace Go
 	       bool v_from_right = true,
 	       double resolution = 1.0e-12) const;
 
+    /// Evaluate the surface, and possibly its derivatives, in a set of
+    /// parameter pairs. The points are grouped by element, and in each
+    /// element the univariate B-splines with support in the element are
+    /// computed once for every distinct parameter value. The result is the
+    /// same as calling point(pts, upar, vpar, derivs) for each pair.
+    /// \param params parameter pairs (u,v), 2 entries per point
+    /// \param derivs the number of derivatives, at most 2
+    /// \param result (derivs+1)*(derivs+2)/2 points of size dimension() for
+    ///        each parameter pair, in the sequence S, S_u, S_v, S_uu, S_uv, S_vv
+    void evalBatch(const std::vector<double>& params, int derivs,
+		   std::vector<double>& result) const;
+
+    /// As evalBatch() above, for parameter pairs known to lie in the
+    /// element elem. The element is not checked, and parameter values are
+    /// not moved inside the domain.
+    void evalBatch(const Element2D* elem, const std::vector<double>& params,
+		   int derivs, std::vector<double>& result) const;
+
     /// Closest point iteration taking benifit from information about
     /// an element in which to start searching
     void closestPoint(const Point& pt,
@@ -588,6 +615,12 @@ namespace Go
   // preceding refine() methods.
   void refine(const std::vector<Refinement2D>& refs, bool absolute=false);
 
+  // As the previous method. In addition, the elements that are created by the
+  // refinement, or that have a modified set of supporting B-splines, are
+  // returned in 'changed_elems'. The pointers are valid until the next refinement.
+  void refine(const std::vector<Refinement2D>& refs, bool absolute,
+	      std::vector<Element2D*>& changed_elems);
+
   // @@@ VSK. Index or iterator? Must define how the elements or bsplines 
   // are refined and call one of the other functions (refine one or refine
   // many). Is there a limit where one should be chosen before the other?
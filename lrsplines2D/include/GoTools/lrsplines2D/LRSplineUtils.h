@@ -127,6 +127,37 @@ namespace Go
 		  int spline_degree, double knot_tol,
 		  Mesh2D& mesh, LRSplineSurface::BSplineMap& bmap);
 
+    // Apply a batch of refinements to the mesh. The result is the same as
+    // calling refine_mesh() for each refinement in turn, but all new knot
+    // lines are inserted in one pass, and the knot indices of the B-splines
+    // in 'bmap' are updated once per parameter direction. The meshrectangles
+    // actually inserted, i.e. with knot values taken from the mesh and
+    // extended to existing knot lines, are returned in 'applied'.
+    // Knot values of new lines that are equal within 'knot_tol' give one
+    // knot line at the smallest of the values, independent of the order
+    // of 'refs'. Sequential refinement gives the same line when the values
+    // are given in increasing order.
+    void refine_mesh_batch(const std::vector<LRSplineSurface::Refinement2D>& refs,
+			   bool absolute, int degree_u, int degree_v,
+			   double knot_tol, Mesh2D& mesh,
+			   LRSplineSurface::BSplineMap& bmap,
+			   std::vector<LRSplineSurface::Refinement2D>& applied);
+
+    // Collect the keys of the elements of 'mesh' that are intersected or 
+    // touched by the meshrectangle of 'ref'. 'mesh' is the mesh prior to
+    // the refinement, and 'ref' is a meshrectangle as returned from
+    // refine_mesh_batch().
+    void elements_touched_by_refinement(const LRSplineSurface::Refinement2D& ref,
+					double knot_tol, const Mesh2D& mesh,
+					std::set<LRSplineSurface::ElemKey>& keys);
+
+    // Create the elements of a refined 'mesh' lying inside 'elem', and
+    // move the data points and ghost points of 'elem' to these elements.
+    // 'dim' is the dimension of the geometry space. No B-spline information
+    // is attached to the new elements.
+    void split_element_by_mesh(Element2D* elem, const Mesh2D& mesh, int dim,
+			       std::vector<std::unique_ptr<Element2D> >& sub_elems);
+
     bool support_equal(const LRBSpline2D* b1, const LRBSpline2D* b2);
 
     bool elementOK(const Element2D* elem, const Mesh2D& m);
@@ -153,6 +184,20 @@ namespace Go
 			      bool add_distance_field = false, 
 			      bool primary_points = true);
 
+    // Permutation sorting 'key' in decreasing order. Equal keys are
+    // ordered by increasing index, thus the permutation is unique and
+    // independent of the number of threads used to compute it
+    void sort_descending_perm(const std::vector<double>& key, 
+			      std::vector<int>& perm);
+
+    // Append the candidate refinements to 'refs', traversing 'cand_refs'
+    // in the given order. A candidate with the same direction and knot value
+    // (within 'tol') as a refinement already in 'refs', and an overlapping
+    // extent, extends the first such refinement instead of being added
+    void merge_refinements(const std::vector<std::vector<LRSplineSurface::Refinement2D> >& cand_refs,
+			   double tol, 
+			   std::vector<LRSplineSurface::Refinement2D>& refs);
+
 
     //==============================================================================
     struct support_compare
@@ -379,8 +379,9 @@ class LRSurfApprox
     // The same as the above, but with OpenMP support (if flag is turned on).
     void computeAccuracyElement_omp(std::vector<double>& points, int nmb, int del,
 				    RectDomain& rd, const Element2D* elem);
-    /// Refine surface
-    int refineSurf();
+    /// Refine surface. The elements created or with a modified
+    /// support are returned in changed_elems
+    int refineSurf(std::vector<Element2D*>& changed_elems);
     void refineSurf2();
 
     /// Create initial LR B-spline surface
@@ -69,15 +69,18 @@ namespace Go
     /// top and from left to right
     /// Only LR B-spline surfaces are modified, but the surfaces may
     /// be trimmed
+    /// If parallel is true, operations on disjoint sets of surfaces are
+    /// performed concurrently. The result is identical to the serial
+    /// stitching
     void stitchRegSfs(std::vector<shared_ptr<ParamSurface> >& sfs,
 		      int nmb_u, int nmb_v, double eps,
-		      int cont);
+		      int cont, bool parallel = false);
 
     /// Perform stitching. The surfaces are organized from bottom to
     /// top and from left to right
     void stitchRegSfs(std::vector<shared_ptr<LRSplineSurface> >& sfs,
 		      int nmb_u, int nmb_v, double eps,
-		      int cont);
+		      int cont, bool parallel = false);
 
     /// We calculate the max distance (cont = 0) / angle (cont = 1) between corresponding edges.
     std::vector<double> analyzeContinuity(std::vector<shared_ptr<ParamSurface> >& sfs,
@@ -85,9 +88,44 @@ namespace Go
 					  int num_edge_samples = 100);
 
   private:
+    enum StitchOpType
+    {
+      TENSOR_STRUCTURE,
+      MATCH_SPLINE_SPACE,
+      AVERAGE_EDGE,
+      AVERAGE_CORNER
+    };
+
+    // One step in the stitching sequence. The involved surfaces are given
+    // by their index in the surface grid and the edge or corner number
+    // concerned
+    struct StitchOp
+    {
+      StitchOpType type_;
+      std::vector<std::pair<int, int> > sfs_;
+
+      StitchOp(StitchOpType type)
+	: type_(type)
+      {
+      }
+    };
+
     void consistentSplineSpaces(std::vector<shared_ptr<LRSplineSurface> >& sfs,
 				int nmb_u, int nmb_v, double eps,
-				int cont);
+				int cont, bool parallel);
+
+    // Perform a sequence of stitching operations. In parallel mode, each
+    // operation is assigned to the first wave following all previous
+    // operations on the same surfaces. The operations in a wave modify
+    // disjoint sets of surfaces, and are performed concurrently
+    void performOps(const std::vector<StitchOp>& ops,
+		    std::vector<shared_ptr<LRSplineSurface> >& sfs,
+		    int nmb_u, int nmb_v, double eps, int cont,
+		    bool parallel);
+
+    void performOp(const StitchOp& op,
+		   std::vector<shared_ptr<LRSplineSurface> >& sfs,
+		   int nmb_u, int nmb_v, double eps, int cont);
 
     // Make sure that the refinements along all edges have a full tensor product structure for
     // the first 'element_width' elements.
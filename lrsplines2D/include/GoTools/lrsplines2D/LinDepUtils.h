@@ -75,6 +75,48 @@ namespace Go
   //============================================================================
   std::vector<LRBSpline2D*> unpeelableBasisFunctions ( const LRSplineSurface& );
 
+  //============================================================================
+  // Peeling check that can be updated after a refinement. Only
+  // overloaded elements, i.e., elements with more than
+  // (degree(XFIXED)+1)*(degree(YFIXED)+1) LR B-splines in their
+  // support, can contain unpeelable LR B-splines. The overloaded
+  // elements are kept between the checks, and after a refinement only
+  // the elements created or with a modified support, as returned by
+  // LRSplineSurface::refine(), are re-examined. The peeling is then
+  // performed on the overloaded elements and the LR B-splines with
+  // support on overloaded elements only. The result is the same as
+  // from unpeelableBasisFunctions().
+  //============================================================================
+  class PeelingCheck
+  {
+  public:
+    PeelingCheck()
+      : max_fun_(0), initialized_(false)
+    {}
+
+    // Full check of an LR spline. The elements are examined for
+    // overloading in parallel. Returns the unpeelable LR B-splines.
+    std::vector<LRBSpline2D*> check(const LRSplineSurface& lrs);
+
+    // Check of the LR spline given in the previous call to check() or
+    // update(), after a refinement. changed_elems are the elements
+    // returned from the refinement. If no previous check is performed,
+    // a full check is done. Returns the unpeelable LR B-splines.
+    std::vector<LRBSpline2D*> update(const LRSplineSurface& lrs,
+				     const std::vector<Element2D*>& changed_elems);
+
+    // Number of overloaded elements found in the last check
+    int numOverloadedElements() const
+    {
+      return (int)overloaded_.size();
+    }
+
+  private:
+    int max_fun_;
+    bool initialized_;
+    std::map<LRSplineSurface::ElemKey, Element2D*> overloaded_;
+  };
+
   } // end namespace LinDepUtils
 
 } // end namespace Go
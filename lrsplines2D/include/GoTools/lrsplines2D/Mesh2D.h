@@ -93,6 +93,14 @@ public:
   // Write the mesh to a stream
   virtual void write(std::ostream& os) const; 
 
+  // Read the mesh from a stream in the binary format written by writeBinary()
+  void readBinary(std::istream& is);
+
+  // Write the mesh to a stream in a binary format. The knot values are stored
+  // as one array per direction, and the meshrectangles of each knot line as
+  // packed (index, multiplicity) pairs. Stored in the byte order of the machine.
+  void writeBinary(std::ostream& os) const;
+
   // Swap two meshes
   void swap(Mesh2D& rhs);             
 
@@ -244,6 +252,19 @@ public:
   //        and 'incrementMult()' member functions).
   int insertLine (Direction2D d, double kval, int mult = 0);
 
+  // Insert several lines in the same direction in one pass.  Equivalent to
+  // calling insertLine() for each value in 'kvals', but the cost is linear in
+  // the size of the mesh rather than in the size of the mesh times the number
+  // of new lines.
+  // d      - direction of the lines, see insertLine()
+  // kvals  - the new knot values, strictly increasing and all different from
+  //          the knot values already in the mesh in the given direction
+  // old_to_new - on return, the new index of each line that was present before
+  //          the insertion (size equal to the previous number of distinct knots)
+  // mult   - the multiplicity of the meshrectangles on the new lines
+  void insertLines(Direction2D d, const std::vector<double>& kvals,
+		   std::vector<int>& old_to_new, int mult = 0);
+
   // Change the parameter domain for the mesh.
   void setParameterDomain(double u1, double u2, double v1, double v2);
 
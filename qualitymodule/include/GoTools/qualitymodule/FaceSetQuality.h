@@ -180,10 +180,33 @@ namespace Go
 		return model_;
 	      }
 
-	    
+	    /// Update the results of the performed tests after the given
+	    /// faces are modified or removed from the model. The face local
+	    /// tests are only performed again for the modified faces, while
+	    /// the remaining tests are reset and recomputed when requested
+	    void revalidate(const std::vector<ftSurface*>& modified_faces);
 
 	private:
 	    shared_ptr<SurfaceModel> model_;
+
+	    // Parameters of the last sliver face test
+	    double sliver_thickness_;
+	    double sliver_factor_;
+
+	    // Result of the face local tests for one face
+	    struct FaceCheck;
+
+	    // Perform a set of face local tests on the given faces and add
+	    // the results to the result container in face order. The faces
+	    // are checked in parallel
+	    void checkFaces(const std::vector<testSuite>& tests,
+			    const std::vector<shared_ptr<ftSurface> >& faces);
+
+	    void checkFace(const std::vector<testSuite>& tests,
+			   shared_ptr<ftSurface> face, FaceCheck& result);
+
+	    // Whether the results of a test depend on one face at the time
+	    static bool isFaceLocal(testSuite whichtest);
 	};
 
 } // namespace Go
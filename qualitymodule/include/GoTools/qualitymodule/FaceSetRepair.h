@@ -44,6 +44,7 @@
 #include "GoTools/qualitymodule/QualityResults.h"
 #include "GoTools/qualitymodule/testSuite.h"
 #include <vector>
+#include <set>
 
 namespace Go
 {
@@ -92,6 +93,14 @@ namespace Go
     bool vertex_update_;
     bool edges_update_;
 
+    // Faces modified since the quality results were last updated
+    std::set<ftSurface*> modified_faces_;
+
+    void addModifiedFaces(std::vector<std::pair<ftEdge*, ftEdge*> >& edges);
+
+    // Update the quality results with respect to the modified faces
+    void updateResults();
+
     void gapTrimming(std::vector<std::pair<ftEdge*, ftEdge*> >& pos_discont,
 		     double epsge, bool update_iso);
 
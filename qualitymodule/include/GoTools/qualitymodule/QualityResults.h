@@ -44,9 +44,12 @@
 #include "GoTools/compositemodel/ftEdge.h"
 #include "GoTools/compositemodel/Vertex.h"
 #include <vector>
+#include <set>
+#include <map>
 
 namespace Go
 {
+  class ftFaceBase;
   class ftSurface;
   class ftCurve;
   class ftPoint;
@@ -75,6 +78,18 @@ namespace Go
     void reset(testSuite whichtest);
     void performtest(testSuite whichtest, double tol);
     bool testPerformed(testSuite whichtest, double& tol);
+
+    // Remove the results of a face local test that belong to the given
+    // faces. Returns false if the result cannot be updated in this way,
+    // in which case the test must be performed anew
+    bool removeFaceResults(testSuite whichtest,
+			   const std::set<ftFaceBase*>& faces);
+
+    // Order the results of a face local test by the index of the face
+    // they belong to. Results belonging to the same face keep their
+    // relative order, results of faces not in face_order are put last
+    void sortFaceResults(testSuite whichtest,
+			 const std::map<ftFaceBase*, int>& face_order);
 	    
     // Result of test for degenerate surface boundaries
     std::vector<shared_ptr<ftSurface> > deg_sfs_;
@@ -45,8 +45,10 @@
 #include "GoTools/utils/Point.h"
 #include "GoTools/utils/BoundingBox.h"
 #include "GoTools/utils/errormacros.h"
+#include "GoTools/utils/timeutils.h"
 #include "GoTools/geometry/ClassType.h"
 #include "GoTools/geometry/CurveOnSurface.h"
+#include "GoTools/geometry/BoundedSurface.h"
 #include "GoTools/geometry/LineCloud.h"
 #include "GoTools/topology/FaceConnectivity.h"
 #include "GoTools/topology/tpTolerances.h"
@@ -55,6 +57,7 @@
 #include <set>
 #include <memory>
 #include <fstream>
+#include <algorithm>
 
 namespace Go
 {
@@ -88,6 +91,7 @@ protected:
 
     tpTolerances tol_;
     std::vector< shared_ptr<edgeType> > new_edges_;  // Intermediate storage of new edges
+    double time_edges_, time_pairs_, time_stitch_;   // Stage times in computeAdjacency
 
 public:
 
@@ -103,14 +107,15 @@ public:
      */
  FaceAdjacency(double tol_gap, double tol_neighbour,
 	       double tol_kink, double tol_bend)
-   : tol_(tpTolerances(tol_gap, tol_neighbour, tol_kink, tol_bend))
+   : tol_(tpTolerances(tol_gap, tol_neighbour, tol_kink, tol_bend)),
+    time_edges_(0.0), time_pairs_(0.0), time_stitch_(0.0)
       {}
 
     /** Constructor.
      * \param tol Topological tolerances
      */
   FaceAdjacency(const tpTolerances& tol)
-   : tol_(tol)
+   : tol_(tol), time_edges_(0.0), time_pairs_(0.0), time_stitch_(0.0)
     {}
 
 
@@ -163,126 +168,201 @@ public:
     {
       int i, j, k, l;
       int num_faces = (int)faces.size();
-      std::vector<Go::BoundingBox> boxes;
-      boxes.reserve(num_faces);
-      // Make sure that the faces are equipped with edges and compute face boxes
+      double t0 = Go::getCurrentTime();
+
+      // Make sure that the faces are equipped with edges and compute face
+      // boxes and the boxes of the initial edges. The faces are independent
+      // of each other at this stage, but the geometry evaluators are not
+      // thread safe. Faces sharing geometry with a previous face are
+      // treated sequentially after the others
+      std::vector<Go::BoundingBox> boxes(num_faces);
+      std::vector<std::vector<Go::BoundingBox> > edge_boxes(num_faces);
+      std::vector<int> sequential;
+      sharedGeometryFaces(faces, sequential);
+      int failed = 0;
+#pragma omp parallel for private(i) schedule(dynamic, 1)
       for (i = 0; i < num_faces; ++i) {
-	(void)faces[i]->createInitialEdges(tol_.neighbour);
-	boxes.push_back(faces[i]->boundingBox());
+	if (sequential[i])
+	  continue;
+	try {
+	  initialEdgesAndBoxes(faces[i].get(), boxes[i], edge_boxes[i]);
+	}
+	catch (...) {
+#pragma omp atomic
+	  failed++;
+	}
       }
+      for (i = 0; i < num_faces; ++i) {
+	if (!sequential[i])
+	  continue;
+	try {
+	  initialEdgesAndBoxes(faces[i].get(), boxes[i], edge_boxes[i]);
+	}
+	catch (...) {
+	  failed++;
+	}
+      }
+      if (failed > 0)
+	THROW("Failed creating initial edges");
+      double t1 = Go::getCurrentTime();
+
+      // Candidate face pairs. The face boxes must overlap and at least
+      // one pair of edges must have overlapping boxes. Edges created by
+      // splitting in the stitching phase below share the geometry curve
+      // of the initial edge, and the initial edge boxes cover them
+      std::vector<std::pair<int,int> > face_pairs;
+      Go::overlappingBoxes(boxes, tol_.neighbour, face_pairs);
+      if (first_idx > 0) {
+	size_t nmb = 0;
+	for (size_t kp = 0; kp < face_pairs.size(); ++kp)
+	  if (face_pairs[kp].second >= first_idx)
+	    face_pairs[nmb++] = face_pairs[kp];
+	face_pairs.resize(nmb);
+      }
+      int nmb_pairs = (int)face_pairs.size();
+      std::vector<int> edge_overlap(nmb_pairs, 0);
+#pragma omp parallel for private(i, k, l) schedule(dynamic, 4)
+      for (i = 0; i < nmb_pairs; ++i) {
+	const std::vector<Go::BoundingBox>& eb0 = edge_boxes[face_pairs[i].first];
+	const std::vector<Go::BoundingBox>& eb1 = edge_boxes[face_pairs[i].second];
+	for (k = 0; k < (int)eb0.size() && edge_overlap[i] == 0; ++k)
+	  for (l = 0; l < (int)eb1.size(); ++l)
+	    if (eb0[k].overlaps(eb1[l], tol_.neighbour)) {
+	      edge_overlap[i] = 1;
+	      break;
+	    }
+      }
+      double t2 = Go::getCurrentTime();
 
       orient_inconsist.clear();
 
+      // Stitching. Edges are split and twin pointers are set, this is
+      // done sequentially in the order of the face pairs
       std::vector<shared_ptr<edgeType> > startedges0, startedges1;
-      for (i = 0; i < num_faces - 1; ++i) {
-	int first = std::max(first_idx, i+1);
-	for (j = first; j < num_faces; ++j) {
-	  // For every combination of faces, do a boxtest.
-	  if (boxes[i].overlaps(boxes[j], tol_.neighbour)) {
-	    // We have some possible neighbourhood incidents.
-	    // Now do a box test on every combination of edges
-	    startedges0 = faces[i]->startEdges();
-	    startedges1 = faces[j]->startEdges();
-	    // Testing all loops in one surface against
-	    // all loops in the other.
-	    for (k = 0; k < int(startedges0.size()); ++k) {
-	      for (l = 0; l < int(startedges1.size()); ++l) {
-		edgeType* s0 = startedges0[k].get();
-		edgeType* s1 = startedges1[l].get();
-		if (s0 ==0 || s1 == 0) break;
-		edgeType* e[2];
-		e[0] = s0;
-		e[1] = s1;
-		edgeType* en[2];
-		bool finished = false;
-		while(!finished) {
-		  en[0] = e[0]->next();
-		  en[1] = e[1]->next();
-		  if (e[0]->twin() && e[0]->twin() == e[1] &&
-		      e[1]->twin() && e[1]->twin() == e[0])
-		    {
-		      // Already tested in the context of edge split
-		      ;
-		    }
-		  else if (e[0]->boundingBox().overlaps(e[1]->boundingBox(),
-						   tol_.neighbour)) {
+      for (int kp = 0; kp < nmb_pairs; ++kp) {
+	if (edge_overlap[kp] == 0)
+	  continue;
+	i = face_pairs[kp].first;
+	j = face_pairs[kp].second;
+	// We have some possible neighbourhood incidents.
+	// Now do a box test on every combination of edges
+	startedges0 = faces[i]->startEdges();
+	startedges1 = faces[j]->startEdges();
+	// Testing all loops in one surface against
+	// all loops in the other.
+	for (k = 0; k < int(startedges0.size()); ++k) {
+	  for (l = 0; l < int(startedges1.size()); ++l) {
+	    edgeType* s0 = startedges0[k].get();
+	    edgeType* s1 = startedges1[l].get();
+	    if (s0 ==0 || s1 == 0) break;
+	    edgeType* e[2];
+	    e[0] = s0;
+	    e[1] = s1;
+	    edgeType* en[2];
+	    bool finished = false;
+	    while(!finished) {
+	      en[0] = e[0]->next();
+	      en[1] = e[1]->next();
+	      if (e[0]->twin() && e[0]->twin() == e[1] &&
+		  e[1]->twin() && e[1]->twin() == e[0])
+		{
+		  // Already tested in the context of edge split
+		  ;
+		}
+	      else if (e[0]->boundingBox().overlaps(e[1]->boundingBox(),
+					       tol_.neighbour)) {
 #ifdef DEBUG
-		  std::ofstream debug("top_debug.g2");
-		  for (int ki = 0; ki < 2; ++ki) {
-		    e[ki]->face()->surface()->writeStandardHeader(debug);
-		    e[ki]->face()->surface()->write(debug);
-		    std::vector<double> pts(12);
-		    Point from = e[ki]->point(e[ki]->tMin());
-		    double tmid = 0.5*(e[ki]->tMin() + e[ki]->tMax());
-		    Point mid = e[ki]->point(tmid);
-		    Point to = e[ki]->point(e[ki]->tMax());
-		    std::copy(from.begin(), from.end(), pts.begin());
-		    std::copy(mid.begin(), mid.end(), pts.begin() + 3);
-		    std::copy(mid.begin(), mid.end(), pts.begin() + 6);
-		    std::copy(to.begin(), to.end(), pts.begin() + 9);
-		    LineCloud lc(pts.begin(), 2);
-		    lc.writeStandardHeader(debug);
-		    lc.write(debug);
-		  }
+	      std::ofstream debug("top_debug.g2");
+	      for (int ki = 0; ki < 2; ++ki) {
+		e[ki]->face()->surface()->writeStandardHeader(debug);
+		e[ki]->face()->surface()->write(debug);
+		std::vector<double> pts(12);
+		Point from = e[ki]->point(e[ki]->tMin());
+		double tmid = 0.5*(e[ki]->tMin() + e[ki]->tMax());
+		Point mid = e[ki]->point(tmid);
+		Point to = e[ki]->point(e[ki]->tMax());
+		std::copy(from.begin(), from.end(), pts.begin());
+		std::copy(mid.begin(), mid.end(), pts.begin() + 3);
+		std::copy(mid.begin(), mid.end(), pts.begin() + 6);
+		std::copy(to.begin(), to.end(), pts.begin() + 9);
+		LineCloud lc(pts.begin(), 2);
+		lc.writeStandardHeader(debug);
+		lc.write(debug);
+	      }
 #endif
-		    // We found an edge overlap. Possible incident.
-		    int incident_occurred = 
-		      testEdges(e);
-		    if (incident_occurred) {
-		      // We skip the rest of this subloop (looping
-		      // over edges e[1] in face faces[j]) by
-		      // making en[1] so that e[0] will be
-		      // incremented.
-		      // If e[0] was split w/t-value higher than
-		      // start value, do not forget first part of
-		      // edge.
-
-		      if (incident_occurred >= 2)
-			{
-			  // Inconsistence in face orientation
-			  // Remember incident
-			  // Check if it has occured before
-			  size_t kr;
-			  for (kr=0; kr<orient_inconsist.size(); ++kr)
-			    if ((orient_inconsist[kr].first == faces[i].get() &&
-				 orient_inconsist[kr].second == faces[j].get()) ||
-				(orient_inconsist[kr].first == faces[j].get() &&
-				 orient_inconsist[kr].second == faces[i].get()))
-			      break;
-
-			  if (kr == orient_inconsist.size())
-			    orient_inconsist.push_back(std::make_pair(faces[i].get(),
-								      faces[j].get()));
-			}
+		// We found an edge overlap. Possible incident.
+		int incident_occurred = 
+		  testEdges(e);
+		if (incident_occurred) {
+		  // We skip the rest of this subloop (looping
+		  // over edges e[1] in face faces[j]) by
+		  // making en[1] so that e[0] will be
+		  // incremented.
+		  // If e[0] was split w/t-value higher than
+		  // start value, do not forget first part of
+		  // edge.
+
+		  if (incident_occurred >= 2)
+		    {
+		      // Inconsistence in face orientation
+		      // Remember incident
+		      // Check if it has occured before
+		      size_t kr;
+		      for (kr=0; kr<orient_inconsist.size(); ++kr)
+			if ((orient_inconsist[kr].first == faces[i].get() &&
+			     orient_inconsist[kr].second == faces[j].get()) ||
+			    (orient_inconsist[kr].first == faces[j].get() &&
+			     orient_inconsist[kr].second == faces[i].get()))
+			  break;
+
+		      if (kr == orient_inconsist.size())
+			orient_inconsist.push_back(std::make_pair(faces[i].get(),
+								  faces[j].get()));
 		    }
-		  }
-
-		  // 17102017. Adjacency analysis functions with an incremental addition
-		  // of faces have a special security net for sliver faces. This may
-		  // need to be included here. 
-
-		  // Just to be sure in case the edge loop has changed
-		  startedges0 = faces[i]->startEdges();
-		  startedges1 = faces[j]->startEdges();
-		  edgeType* s0 = startedges0[k].get();
-		  edgeType* s1 = startedges1[l].get();
-		  if (s0 ==0 || s1 == 0) 
-		    break;
-		  // Pick next edges, check if we're done
-		  //e[1] = en[1];
-		  e[1] = e[1]->next();
-		  if (e[1] == s1) {
-		    //e[0] = en[0];
-		    e[0] = e[0]->next();
-		    if (e[0] == s0)
-		      finished = true;
-		  }
 		}
 	      }
+
+	      // 17102017. Adjacency analysis functions with an incremental addition
+	      // of faces have a special security net for sliver faces. This may
+	      // need to be included here. 
+
+	      // Just to be sure in case the edge loop has changed
+	      startedges0 = faces[i]->startEdges();
+	      startedges1 = faces[j]->startEdges();
+	      edgeType* s0 = startedges0[k].get();
+	      edgeType* s1 = startedges1[l].get();
+	      if (s0 ==0 || s1 == 0) 
+		break;
+	      // Pick next edges, check if we're done
+	      //e[1] = en[1];
+	      e[1] = e[1]->next();
+	      if (e[1] == s1) {
+		//e[0] = en[0];
+		e[0] = e[0]->next();
+		if (e[0] == s0)
+		  finished = true;
+	      }
 	    }
 	  }
 	}
       }
+      double t3 = Go::getCurrentTime();
+
+      time_edges_ = t1 - t0;
+      time_pairs_ = t2 - t1;
+      time_stitch_ = t3 - t2;
+    }
+
+    /// Wall clock time (seconds) spent in the stages of the last call to
+    /// computeAdjacency()
+    /// \retval edges Initial edges and face and edge boxes
+    /// \retval pairs Candidate face pairs
+    /// \retval stitch Splitting of edges and setting of twin pointers
+    void stageTimes(double& edges, double& pairs, double& stitch) const
+    {
+      edges = time_edges_;
+      pairs = time_pairs_;
+      stitch = time_stitch_;
     }
 
     //=======================================================================
@@ -904,7 +984,59 @@ public:
     
  private:
 
+    //=======================================================================
+    // Mark faces whose geometry is shared with a previous face, or which
+    // is evaluated through geometry outside the face set
+    void sharedGeometryFaces(const std::vector<shared_ptr<faceType> >& faces,
+			     std::vector<int>& sequential)
+    //=======================================================================
+    {
+      sequential.assign(faces.size(), 0);
+      std::set<const Go::ParamSurface*> used;
+      for (size_t ki = 0; ki < faces.size(); ++ki) {
+	shared_ptr<Go::ParamSurface> surf = faces[ki]->surface();
+	const Go::ParamSurface* geom = surf.get();
+	if (geom == 0)
+	  continue;
+	if (geom->instanceType() == Go::Class_BoundedSurface)
+	  geom = static_cast<const Go::BoundedSurface*>(geom)->underlyingSurface().get();
+	if (geom->instanceType() == Go::Class_SurfaceOnVolume ||
+	    geom->instanceType() == Go::Class_ParameterSurfaceOnVolume)
+	  sequential[ki] = 1;
+	else if (!used.insert(geom).second)
+	  sequential[ki] = 1;
+      }
+    }
+
+    //=======================================================================
+    // Make sure that a face is equipped with edges and compute the face
+    // box and the boxes of the initial edges
+    void initialEdgesAndBoxes(faceType* face, Go::BoundingBox& box,
+			      std::vector<Go::BoundingBox>& edge_boxes)
+    //=======================================================================
+    {
+      (void)face->createInitialEdges(tol_.neighbour);
+      box = face->boundingBox();
+      loopEdgeBoxes(face, edge_boxes);
+    }
 
+    //=======================================================================
+    // Collect the boxes of all edges in the boundary loops of a face
+    void loopEdgeBoxes(faceType* face, std::vector<Go::BoundingBox>& boxes)
+    //=======================================================================
+    {
+      std::vector<shared_ptr<edgeType> > startedges = face->startEdges();
+      for (size_t ki = 0; ki < startedges.size(); ++ki) {
+	edgeType* s = startedges[ki].get();
+	if (s == 0)
+	  continue;
+	edgeType* e = s;
+	do {
+	  boxes.push_back(e->boundingBox());
+	  e = e->next();
+	} while (e != 0 && e != s);
+      }
+    }
 
     //=======================================================================
     int testEdges(edgeType* e[2])
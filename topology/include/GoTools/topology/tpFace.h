@@ -49,6 +49,7 @@ namespace Go
 {
 
 class tpEdge;
+class ParamSurface;
 
 
 //===========================================================================
@@ -84,6 +85,7 @@ public:
     virtual Point normal(double u, double v) const = 0;
     /// The bounding box corresponding to this face
     virtual BoundingBox boundingBox() = 0;
+    virtual shared_ptr<ParamSurface> surface() = 0;
     /// Return id, default id is -1
     virtual int getId() = 0;
     /// Remove all adjacency information related to this face
@@ -938,6 +938,40 @@ public:
 			  std::vector<BasisDerivs2>& result,
 			  bool evaluate_from_right = true) const;
 
+    /// Evaluate the basis functions in a specified grid and store the
+    /// result in one contiguous buffer instead of one BasisPts entry per
+    /// grid point. The values are identical to those returned by the
+    /// BasisPts version. The grid points are ordered with the first
+    /// parameter direction running fastest.
+    /// \param param_u the parameter values in the first direction
+    /// \param param_v the parameter values in the second direction
+    /// \param param_w the parameter values in the third direction
+    /// \param basisValues the non-zero basis functions in all grid points,
+    ///                    (degree_u+1)*(degree_v+1)*(degree_w+1) values per point
+    /// \param left the knot interval indices, three entries per grid point
+    void computeBasisGrid(const Dvector& param_u,
+			  const Dvector& param_v,
+			  const Dvector& param_w,
+			  Dvector& basisValues,
+			  std::vector<int>& left) const;
+
+    /// Evaluate the basis functions and their first derivatives in a
+    /// specified grid, contiguous storage. See the previous function.
+    /// \param basisDerivs_u the derivative of all basis functions in the
+    ///                      first parameter direction, same layout as basisValues
+    /// \param basisDerivs_v the derivative in the second parameter direction
+    /// \param basisDerivs_w the derivative in the third parameter direction
+    /// \param evaluate_from_right specifies directional derivatives, true=right, false=left
+    void computeBasisGrid(const Dvector& param_u,
+			  const Dvector& param_v,
+			  const Dvector& param_w,
+			  Dvector& basisValues,
+			  Dvector& basisDerivs_u,
+			  Dvector& basisDerivs_v,
+			  Dvector& basisDerivs_w,
+			  std::vector<int>& left,
+			  bool evaluate_from_right = true) const;
+
 
     // inherited from ParamVolume
     virtual double nextSegmentVal(int dir, double par, bool forward, double tol) const;
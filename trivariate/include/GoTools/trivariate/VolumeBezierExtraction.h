@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _VOLUMEBEZIEREXTRACTION_H
+#define _VOLUMEBEZIEREXTRACTION_H
+
+#include "GoTools/geometry/BezierExtraction.h"
+#include "GoTools/utils/BoundingBox.h"
+#include <vector>
+
+
+namespace Go
+{
+
+  class SplineVolume;
+
+  /** Bezier extraction for a spline volume.
+   *
+   * Holds the extraction operators in all three parameter directions, and
+   * extracts Bernstein blocks and element bounding boxes from a volume
+   * defined on the same spline space. The extraction depends only on the
+   * knot vectors, and must be recomputed if the spline space of the
+   * volume is changed. See also SurfaceBezierExtraction.
+   */
+
+class VolumeBezierExtraction
+{
+public:
+    /// Constructs an empty extraction
+    VolumeBezierExtraction();
+
+    /// Compute the extraction operators of the spline space of a volume
+    explicit VolumeBezierExtraction(const SplineVolume& vol);
+
+    /// Compute the extraction operators of the spline space of a volume,
+    /// replacing current content
+    void setVolume(const SplineVolume& vol);
+
+    /// The extraction operators in one parameter direction
+    const BezierExtraction& extraction(int pardir) const
+    { return extraction_[pardir]; }
+
+    /// Number of elements in one parameter direction
+    int numElements(int pardir) const
+    { return extraction_[pardir].numElements(); }
+
+    /// Bernstein coefficients of the volume over the element
+    /// (el_u, el_v, el_w). The coefficients are stored with the first
+    /// parameter direction running fastest. For rational volumes
+    /// homogeneous coordinates are returned.
+    void bernsteinBlock(const SplineVolume& vol, int el_u, int el_v, int el_w,
+			std::vector<double>& bez) const;
+
+    /// Bounding box of the volume over one element, computed from the
+    /// Bernstein coefficients
+    BoundingBox elementBoundingBox(const SplineVolume& vol,
+				   int el_u, int el_v, int el_w) const;
+
+private:
+    BezierExtraction extraction_[3];
+};
+
+} // namespace Go
+
+#endif // _VOLUMEBEZIEREXTRACTION_H
+
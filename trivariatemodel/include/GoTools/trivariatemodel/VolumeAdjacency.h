@@ -41,6 +41,7 @@
 #define _VOLUMEADJACENCY_H
 
 #include "GoTools/compositemodel/Body.h"
+#include <map>
 
 namespace Go
 {
@@ -58,7 +59,8 @@ namespace Go
     /// Destructor
     ~VolumeAdjacency();
 
-    /// Perform topology analysis on a set of bodies
+    /// Perform topology analysis on a set of bodies. The bodies replace
+    /// the currently registered bodies, see addSolid()
     void setAdjacency(std::vector<shared_ptr<Body> >& solids);
 
     /// Perform topology analysis on a set of bodies where it is assumed
@@ -67,6 +69,31 @@ namespace Go
     void setAdjacency(std::vector<shared_ptr<Body> >& solids, 
 		      int new_solid_pos);
 
+    /// Perform topology analysis between a new body and the bodies
+    /// registered already. The bodies given to setAdjacency(solids) and
+    /// registerSolids() are registered, and the new body is added to
+    /// the register. Only registered bodies with a bounding box close
+    /// to the box of the new body are checked.
+    void addSolid(shared_ptr<Body> solid);
+
+    /// Register bodies where the topological relationship is known already
+    void registerSolids(const std::vector<shared_ptr<Body> >& solids);
+
+    /// Remove a body from the register
+    void removeSolid(Body* solid);
+
+    /// Number of registered bodies
+    int nmbSolids() const
+    {
+      return (int)solid_idx_.size();
+    }
+
+    /// Check if a body is registered
+    bool isRegistered(Body* solid) const
+    {
+      return (solid_idx_.find(solid) != solid_idx_.end());
+    }
+
     private:
     /// Gap between volumes
     double gap_;
@@ -75,14 +102,34 @@ namespace Go
     /// neighbour_ > gap_
     double neighbour_;
 
-    /// Check for adjacency between two solids
-    void setAdjacency(shared_ptr<Body> solid1, shared_ptr<Body> solid2);
+    /// Registered bodies and their bounding boxes. Removed bodies leave
+    /// an empty entry
+    std::vector<shared_ptr<Body> > solids_;
+    std::vector<BoundingBox> boxes_;
+
+    /// Index of the registered bodies
+    std::map<Body*, int> solid_idx_;
+
+    /// The registered bodies sorted by the lower x-value of the boxes
+    std::multimap<double, int> xlow_;
+
+    /// Largest box extent in the x-direction
+    double max_xsize_;
+
+    /// Add a body to the register
+    void registerSolid(shared_ptr<Body> solid, const BoundingBox& box);
+
+    /// Check for adjacency between pairs of solids
+    void setAdjacency(const std::vector<shared_ptr<Body> >& solids,
+		      const std::vector<std::pair<int, int> >& solid_pairs);
 
     /// Check for adjacency between two boundary faces, split faces in case
     /// of partial adjacency (one face embedded in the other, general partial
-    /// coincidence is not handled)
+    /// coincidence is not handled). coincidence is the result of the
+    /// identity test between the surfaces of the faces, see Identity
     int faceAdjacency(shared_ptr<ftSurface> face1, 
 		      shared_ptr<ftSurface> face2,
+		      int coincidence,
 		      std::vector<shared_ptr<ftSurface> >& new_faces1,
 		      std::vector<shared_ptr<ftSurface> >& new_faces2);
 
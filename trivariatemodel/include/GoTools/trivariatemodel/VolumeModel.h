@@ -48,6 +48,7 @@ namespace Go
 {
   class IntResultsModel;
   class GeneralMesh;
+  class VolumeAdjacency;
 
   /// \brief A set of volumes including topology information.
 
@@ -281,6 +282,10 @@ namespace Go
 
   double approxtol_;
 
+  /// Register of the bodies with a known topological relationship,
+  /// used to find the neighbours of appended bodies
+  shared_ptr<VolumeAdjacency> adjacency_;
+
   /// Local storage of intersection results. Used internally in VolumeModel.
   typedef struct intersection_point 
   {
@@ -377,6 +377,14 @@ namespace Go
 			       std::vector<shared_ptr<ftVolume> >& sub_elem,
 			       std::vector<int>& is_inside);
 
+    /// Split a number of elements by the trimming surfaces, see 
+    /// splitElementByTrimSfs. The elements are split concurrently, 
+    /// each thread working on a copy of the trimmed volume. 
+    /// sub_elem[ki] and is_inside[ki] correspond to elem_ix[ki]
+    void splitElementsByTrimSfs(const std::vector<int>& elem_ix, double eps,
+				std::vector<std::vector<shared_ptr<ftVolume> > >& sub_elem,
+				std::vector<std::vector<int> >& is_inside);
+
     /// Debug
     bool checkBodyTopology();
 
@@ -396,6 +404,10 @@ namespace Go
       getBoundaryFaces(shared_ptr<ParamVolume> vol,
 		       double eps, double tang_eps);
 
+    /// Copy of the volume and the boundary shells with no geometry
+    /// shared with this volume. Used for concurrent evaluation
+    shared_ptr<ftVolume> geometryCopy() const;
+
     /// Sort boundary faces in a regular ftVolume
     bool 
       sortRegularSurfaces(std::vector<shared_ptr<ParamSurface> >& sorted_sfs,